@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -27,6 +28,29 @@ using keypop::reader::selection::ScheduledCardSelectionsResponse;
  * <p>Contains the event origin (reader name), the event type and possibly the
  * card selection response (when available).
  *
+ * <p>To avoid any heap allocation in the steady state, an implementation may
+ * preallocate the events of each reader and reuse them for later events of the
+ * same reader. An event is reused only if no std::shared_ptr to it is held
+ * outside the implementation once the notification is complete (use count
+ * back to one), and the ScheduledCardSelectionsResponse it carries is reused
+ * only if, in addition, no std::shared_ptr to the response itself is held
+ * outside the event (use count back to one as well). An observer keeping a
+ * copy of the event or only of its response, e.g. to parse it later on
+ * another thread, therefore keeps it unchanged, the implementation taking
+ * another slot in the meantime.
+ *
+ * <p>Since std::shared_ptr::use_count() is a relaxed read, observing a use
+ * count of one does not by itself order the accesses made by the thread that
+ * released the last other copy before the reuse: the implementation must
+ * issue an acquire fence (std::atomic_thread_fence(std::memory_order_acquire))
+ * after observing it and before modifying the event or its response.
+ *
+ * <p>Only the observers overriding
+ * spi::CardReaderObserverSpi::onReaderEventByReference() receive the event
+ * without any copy of the std::shared_ptr; with the default implementation,
+ * which forwards to spi::CardReaderObserverSpi::onReaderEvent(), a copy is
+ * made, and released, for each notification.
+ *
  * @since 1.0.0
  */
 class CardReaderEvent {
@@ -66,6 +90,41 @@ public:
         UNAVAILABLE
     };
 
+    /**
+     * Set of event types, one bit per Type.
+     *
+     * @see typeMask(const Type)
+     * @since 2.1.0
+     */
+    typedef std::uint32_t TypeMask;
+
+    /**
+     * Returns the mask of a single event type. Masks are combined with the
+     * bitwise OR operator, e.g. typeMask(CARD_MATCHED) | typeMask(UNAVAILABLE).
+     *
+     * @param type The event type.
+     * @return A mask having a single bit set.
+     * @since 2.1.0
+     */
+    static constexpr TypeMask
+    typeMask(const Type type)
+    {
+        return static_cast<TypeMask>(1u << type);
+    }
+
+    /**
+     * Returns the mask of all the event types.
+     *
+     * @return A mask having the bits of all the event types set.
+     * @since 2.1.0
+     */
+    static constexpr TypeMask
+    allTypesMask()
+    {
+        return typeMask(CARD_INSERTED) | typeMask(CARD_MATCHED)
+               | typeMask(CARD_REMOVED) | typeMask(UNAVAILABLE);
+    }
+
     /**
      * Returns the name of the reader that generated the event.
      *
@@ -10,17 +10,21 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 #include "keypop/reader/CardReader.hpp"
+#include "keypop/reader/CardReaderEvent.hpp"
 #include "keypop/reader/spi/CardReaderObservationExceptionHandlerSpi.hpp"
 #include "keypop/reader/spi/CardReaderObserverSpi.hpp"
+#include "keypop/reader/spi/TaskExecutorSpi.hpp"
 
 namespace keypop {
 namespace reader {
 
 using keypop::reader::spi::CardReaderObservationExceptionHandlerSpi;
 using keypop::reader::spi::CardReaderObserverSpi;
+using keypop::reader::spi::TaskExecutorSpi;
 
 /**
  * Card reader able to observe the insertion/removal of cards.
@@ -73,6 +77,39 @@ public:
         MATCHED_ONLY
     };
 
+    /**
+     * The options that apply when the event dispatch queue is full.
+     *
+     * @see setEventDispatchQueue(const std::size_t, const
+     * EventQueueOverflowPolicy, std::shared_ptr<TaskExecutorSpi>)
+     * @since 2.1.0
+     */
+    enum EventQueueOverflowPolicy {
+        /**
+         * The card detection waits until the observers have consumed an event.
+         * No event is lost.
+         *
+         * @since 2.1.0
+         */
+        BLOCK,
+
+        /**
+         * The oldest queued event is discarded to make room for the new one.
+         *
+         * @since 2.1.0
+         */
+        DROP_OLDEST,
+
+        /**
+         * The new event is kept aside, replacing any event previously kept
+         * aside, and is queued as soon as room is available. Only the most
+         * recent of the events produced while the queue is full is delivered.
+         *
+         * @since 2.1.0
+         */
+        COALESCE
+    };
+
     /**
      * Sets the exception handler.
      *
@@ -98,6 +135,9 @@ public:
      * interface to be able to receive the events produced by this reader (card
      * insertion, removal, etc.)
      *
+     * <p>The observer subscribes to all the event types, as if registered
+     * with CardReaderEvent#allTypesMask().
+     *
      * @param observer An observer object implementing the required interface
      * (should be not null).
      * @throw IllegalArgumentException If the provided observer is null.
@@ -106,6 +146,38 @@ public:
     virtual void addObserver(std::shared_ptr<CardReaderObserverSpi> observer)
         = 0;
 
+    /**
+     * Registers a new observer to be notified only of the reader events of
+     * the provided types.
+     *
+     * <p>The events of the other types are not delivered to the observer. When
+     * no registered observer subscribed to the type of an event, the event,
+     * and possibly the ScheduledCardSelectionsResponse it would carry, is not
+     * even built.
+     *
+     * <p>If the observer is already registered, its event types are replaced
+     * by the provided ones.
+     *
+     * <pre>
+     * reader->addObserver(
+     *     metricsObserver,
+     *     CardReaderEvent::typeMask(CardReaderEvent::UNAVAILABLE));
+     * </pre>
+     *
+     * @param observer An observer object implementing the required interface
+     * (should be not null).
+     * @param eventTypeMask The event types, combined with
+     * CardReaderEvent#typeMask(const CardReaderEvent::Type).
+     * @throw IllegalArgumentException If the provided observer is null or the
+     * mask does not contain any event type.
+     * @see addObserver(std::shared_ptr<CardReaderObserverSpi>)
+     * @since 2.1.0
+     */
+    virtual void addObserver(
+        std::shared_ptr<CardReaderObserverSpi> observer,
+        const CardReaderEvent::TypeMask eventTypeMask)
+        = 0;
+
     /**
      * Unregisters a reader observer.
      *
@@ -135,6 +207,52 @@ public:
      */
     virtual int countObservers() const = 0;
 
+    /**
+     * Decouples the card detection from the notification of the observers
+     * through a bounded event queue.
+     *
+     * <p>By default, the observers are notified by the thread that detects
+     * the card, so that a slow observer delays the detection of the next
+     * card. Once this method is invoked, the detection thread only appends
+     * the events to a lock-free queue of the provided capacity, and the
+     * observers are notified by a dispatch task submitted to the provided
+     * executor (see keypop::reader::cpp::BoundedEventQueue for a reference
+     * implementation of such a queue).
+     *
+     * <p>The events of the reader are still delivered one at a time and in
+     * the order in which they occurred. The overflow policy determines what
+     * happens when the observers do not keep up and the queue is full.
+     *
+     * <p>The exceptions thrown by the observers on the executor are reported,
+     * as on the detection thread, to the
+     * CardReaderObservationExceptionHandlerSpi set with
+     * setReaderObservationExceptionHandler(
+     * std::shared_ptr<CardReaderObservationExceptionHandlerSpi>), and do not
+     * stop the dispatch of the next events.
+     *
+     * <p>This method must be invoked while the card detection is stopped,
+     * i.e. before startCardDetection(const DetectionMode) or after
+     * stopCardDetection(). In the latter case, the events still pending in
+     * the previous queue are delivered by the previous executor before any
+     * event of the next card detection.
+     *
+     * @param capacity The maximum number of pending events, applied exactly:
+     * the overflow policy applies as soon as this number of events is
+     * pending, whatever its value.
+     * @param overflowPolicy The policy applied when the queue is full.
+     * @param executor The executor running the notification of the
+     * observers.
+     * @throw IllegalArgumentException If capacity is 0 or if the provided
+     * executor is null.
+     * @throw IllegalStateException If the card detection is started.
+     * @since 2.1.0
+     */
+    virtual void setEventDispatchQueue(
+        const std::size_t capacity,
+        const EventQueueOverflowPolicy overflowPolicy,
+        std::shared_ptr<TaskExecutorSpi> executor)
+        = 0;
+
     /**
      * Starts the card detection. Once activated, the application can be
      * notified of the arrival of a card.
@@ -14,6 +14,7 @@
 #include <string>
 
 #include "keypop/reader/selection/BasicCardSelector.hpp"
+#include "keypop/reader/selection/CardSelectionCancellationToken.hpp"
 #include "keypop/reader/selection/CardSelectionManager.hpp"
 #include "keypop/reader/selection/IsoCardSelector.hpp"
 
@@ -21,6 +22,7 @@ namespace keypop {
 namespace reader {
 
 using keypop::reader::selection::BasicCardSelector;
+using keypop::reader::selection::CardSelectionCancellationToken;
 using keypop::reader::selection::CardSelectionManager;
 using keypop::reader::selection::IsoCardSelector;
 
@@ -60,6 +62,15 @@ public:
      * @since 2.0.0
      */
     virtual std::shared_ptr<IsoCardSelector> createIsoCardSelector() = 0;
+
+    /**
+     * Returns a new instance of CardSelectionCancellationToken.
+     *
+     * @return A new instance of CardSelectionCancellationToken.
+     * @since 2.1.0
+     */
+    virtual std::shared_ptr<CardSelectionCancellationToken>
+    createCardSelectionCancellationToken() = 0;
 };
 
 } /* namespace reader */
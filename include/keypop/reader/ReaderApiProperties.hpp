@@ -36,7 +36,7 @@ namespace reader {
 //     ReaderApiProperties() {}
 // };
 
-static const std::string& ReaderApiProperties_VERSION = "2.0";
+static const std::string& ReaderApiProperties_VERSION = "2.1";
 
 } /* namespace reader */
 } /* namespace keypop */
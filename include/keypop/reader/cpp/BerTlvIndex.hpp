@@ -0,0 +1,398 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "keypop/reader/cpp/ByteView.hpp"
+
+namespace keypop {
+namespace reader {
+namespace cpp {
+
+/**
+ * Flat index of the BER-TLV data objects of a "Select Application" response
+ * (FCI, FCP or FMD template), built on first access.
+ *
+ * <p>The index is stored inside the object (no heap allocation) and refers to
+ * the indexed bytes without copying them, so the indexed data must outlive
+ * it. All the data objects, including those nested in constructed ones, are
+ * indexed in document order up to MAX_ENTRIES; the first occurrence of each
+ * tag can then be found in constant time through an open-addressing table.
+ *
+ * <p>Tags are handled as unsigned integers made of their bytes, e.g. 0x84 for
+ * the DF name or 0xBF0C for the FCI issuer discretionary data.
+ *
+ * <p>An instance must not be used concurrently from several threads, since the
+ * index is built lazily by the const accessors.
+ *
+ * @since 2.1.0
+ */
+class BerTlvIndex final {
+public:
+    enum : std::size_t {
+        /**
+         * Maximum number of data objects indexed.
+         *
+         * @since 2.1.0
+         */
+        MAX_ENTRIES = 48,
+
+        /**
+         * Maximum nesting depth of constructed data objects.
+         *
+         * @since 2.1.0
+         */
+        MAX_DEPTH = 8
+    };
+
+    /**
+     * Indexed data object.
+     *
+     * @since 2.1.0
+     */
+    struct Entry {
+        /**
+         * The tag, e.g. 0x6F or 0xBF0C.
+         */
+        std::uint32_t tag;
+
+        /**
+         * The nesting depth, 0 for top-level data objects.
+         */
+        std::uint8_t depth;
+
+        /**
+         * The offset of the value in the indexed data.
+         */
+        std::uint16_t valueOffset;
+
+        /**
+         * The length of the value.
+         */
+        std::uint16_t valueLength;
+    };
+
+    /**
+     * Creates an index over BER-TLV encoded data. Nothing is parsed until the
+     * first access.
+     *
+     * @param data The BER-TLV data, without status word.
+     * @since 2.1.0
+     */
+    explicit BerTlvIndex(const ByteView data)
+    : mData(data), mBuilt(false), mValid(false), mTruncated(false), mSize(0)
+    {
+    }
+
+    /**
+     * Creates an index over the data of a "Select Application" response, i.e.
+     * the response without its two-byte status word.
+     *
+     * @param selectApplicationResponse The response, including the status
+     * word, as returned by
+     * keypop::reader::selection::spi::ByteViewIsoSmartCard
+     * ::getSelectApplicationResponseBytes().
+     * @return A new index.
+     * @since 2.1.0
+     */
+    static BerTlvIndex
+    fromSelectApplicationResponse(const ByteView selectApplicationResponse)
+    {
+        const std::size_t size = selectApplicationResponse.size();
+
+        return BerTlvIndex(ByteView(
+            selectApplicationResponse.data(), size >= 2 ? size - 2 : 0));
+    }
+
+    /**
+     * Finds the value of the first data object having the provided tag.
+     *
+     * @param tag The tag.
+     * @return An empty view if the tag is absent (or present with an empty
+     * value, which contains() allows to distinguish).
+     * @since 2.1.0
+     */
+    ByteView
+    find(const std::uint32_t tag) const
+    {
+        const Entry* const entry = findEntry(tag);
+        if (entry == nullptr) {
+            return ByteView();
+        }
+
+        return ByteView(mData.data() + entry->valueOffset, entry->valueLength);
+    }
+
+    /**
+     * Indicates whether a data object having the provided tag is present.
+     *
+     * @param tag The tag.
+     * @return <b>true</b> if the tag is present.
+     * @since 2.1.0
+     */
+    bool
+    contains(const std::uint32_t tag) const
+    {
+        return findEntry(tag) != nullptr;
+    }
+
+    /**
+     * Finds the first data object having the provided tag.
+     *
+     * @param tag The tag.
+     * @return Null if the tag is absent.
+     * @since 2.1.0
+     */
+    const Entry*
+    findEntry(const std::uint32_t tag) const
+    {
+        build();
+
+        for (std::size_t i = slotOf(tag), n = 0; n < SLOT_COUNT;
+             i = (i + 1) & (SLOT_COUNT - 1), n++) {
+            const int index = mSlots[i];
+            if (index < 0) {
+                return nullptr;
+            }
+            if (mEntries[index].tag == tag) {
+                return &mEntries[index];
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Returns the number of indexed data objects.
+     *
+     * @return A value between 0 and MAX_ENTRIES.
+     * @since 2.1.0
+     */
+    std::size_t
+    size() const
+    {
+        build();
+
+        return mSize;
+    }
+
+    /**
+     * Returns an indexed data object, in document order.
+     *
+     * @param index The index of the data object, lower than size().
+     * @return The data object.
+     * @since 2.1.0
+     */
+    const Entry&
+    operator[](const std::size_t index) const
+    {
+        build();
+
+        return mEntries[index];
+    }
+
+    /**
+     * Indicates whether the data are well-formed BER-TLV.
+     *
+     * <p>When the data are malformed, the data objects preceding the error are
+     * still indexed.
+     *
+     * @return <b>true</b> if the whole data could be parsed.
+     * @since 2.1.0
+     */
+    bool
+    isValid() const
+    {
+        build();
+
+        return mValid;
+    }
+
+    /**
+     * Indicates whether some data objects were not indexed because there are
+     * more than MAX_ENTRIES or they are nested deeper than MAX_DEPTH.
+     *
+     * @return <b>true</b> if the index is incomplete.
+     * @since 2.1.0
+     */
+    bool
+    isTruncated() const
+    {
+        build();
+
+        return mTruncated;
+    }
+
+private:
+    enum : std::size_t {
+        /**
+         * Number of slots of the lookup table, a power of two greater than
+         * MAX_ENTRIES.
+         */
+        SLOT_COUNT = 128
+    };
+
+    /**
+     *
+     */
+    static std::size_t
+    slotOf(const std::uint32_t tag)
+    {
+        return static_cast<std::size_t>((tag * 2654435761u) >> 25);
+    }
+
+    /**
+     * Parses the data and fills the index, once.
+     */
+    void
+    build() const
+    {
+        if (mBuilt) {
+            return;
+        }
+        mBuilt = true;
+
+        for (std::size_t i = 0; i < SLOT_COUNT; i++) {
+            mSlots[i] = -1;
+        }
+
+        /* End offsets of the enclosing constructed data objects */
+        std::size_t ends[MAX_DEPTH + 1];
+        std::size_t depth = 0;
+        ends[0] = mData.size();
+
+        const std::uint8_t* const bytes = mData.data();
+        std::size_t offset = 0;
+
+        while (true) {
+            while (depth > 0 && offset == ends[depth]) {
+                depth--;
+            }
+            if (offset == ends[depth]) {
+                break;
+            }
+
+            /* Tag */
+            const bool constructed = (bytes[offset] & 0x20) != 0;
+            std::uint32_t tag = bytes[offset];
+            if ((bytes[offset++] & 0x1F) == 0x1F) {
+                std::size_t tagLength = 1;
+                do {
+                    if (offset >= ends[depth] || ++tagLength > 4) {
+                        return;
+                    }
+                    tag = (tag << 8) | bytes[offset];
+                } while ((bytes[offset++] & 0x80) != 0);
+            }
+
+            /* Length */
+            if (offset >= ends[depth]) {
+                return;
+            }
+            std::size_t length = bytes[offset++];
+            if (length & 0x80) {
+                const std::size_t lengthBytes = length & 0x7F;
+                if (lengthBytes == 0 || lengthBytes > 2
+                    || offset + lengthBytes > ends[depth]) {
+                    return;
+                }
+                length = 0;
+                for (std::size_t i = 0; i < lengthBytes; i++) {
+                    length = (length << 8) | bytes[offset++];
+                }
+            }
+            if (length > ends[depth] - offset) {
+                return;
+            }
+
+            /* Entry */
+            if (mSize < MAX_ENTRIES && offset + length <= 0xFFFF) {
+                Entry& entry = mEntries[mSize];
+                entry.tag = tag;
+                entry.depth = static_cast<std::uint8_t>(depth);
+                entry.valueOffset = static_cast<std::uint16_t>(offset);
+                entry.valueLength = static_cast<std::uint16_t>(length);
+                insert(tag, static_cast<int>(mSize));
+                mSize++;
+            } else {
+                mTruncated = true;
+            }
+
+            if (constructed && depth < MAX_DEPTH) {
+                ends[++depth] = offset + length;
+            } else {
+                if (constructed) {
+                    mTruncated = true;
+                }
+                offset += length;
+            }
+        }
+
+        mValid = true;
+    }
+
+    /**
+     * Records the first occurrence of a tag in the lookup table.
+     */
+    void
+    insert(const std::uint32_t tag, const int index) const
+    {
+        std::size_t i = slotOf(tag);
+        while (mSlots[i] >= 0) {
+            if (mEntries[mSlots[i]].tag == tag) {
+                return;
+            }
+            i = (i + 1) & (SLOT_COUNT - 1);
+        }
+        mSlots[i] = static_cast<std::int8_t>(index);
+    }
+
+    /**
+     *
+     */
+    ByteView mData;
+
+    /**
+     *
+     */
+    mutable bool mBuilt;
+
+    /**
+     *
+     */
+    mutable bool mValid;
+
+    /**
+     *
+     */
+    mutable bool mTruncated;
+
+    /**
+     *
+     */
+    mutable std::size_t mSize;
+
+    /**
+     *
+     */
+    mutable Entry mEntries[MAX_ENTRIES];
+
+    /**
+     * Entry indexes by tag hash, -1 for empty slots.
+     */
+    mutable std::int8_t mSlots[SLOT_COUNT];
+};
+
+} /* namespace cpp */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,198 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace keypop {
+namespace reader {
+namespace cpp {
+
+/**
+ * Bounded lock-free FIFO queue, reference building block of the event dispatch
+ * stage of a keypop::reader::ObservableCardReader.
+ *
+ * <p>The queue is an array of exactly capacity() cells, each carrying a turn
+ * counter telling whether it is waiting for a push or a pop of a given lap
+ * (as in E. Rigtorp's bounded MPMC queue): tryPush() and tryPop() never block,
+ * never allocate and can be invoked concurrently from any number of threads.
+ * The elements are delivered in the order in which they were pushed, so that
+ * a queue per reader preserves the order of its events. A push fails as soon
+ * as capacity() elements are pending, for any capacity including 1.
+ *
+ * <p>Since tryPop() may also be invoked by the producer, the
+ * keypop::reader::ObservableCardReader::EventQueueOverflowPolicy#DROP_OLDEST
+ * policy is implemented by popping the oldest element and pushing again.
+ *
+ * @param <T> The element type, default constructible and move assignable,
+ * typically std::shared_ptr<CardReaderEvent>.
+ * @since 2.1.0
+ */
+template <typename T>
+class BoundedEventQueue final {
+public:
+    /**
+     * Creates a queue.
+     *
+     * @param capacity The maximum number of pending elements.
+     * @throw std::invalid_argument If capacity is 0.
+     * @since 2.1.0
+     */
+    explicit BoundedEventQueue(const std::size_t capacity)
+    : mCapacity(checkCapacity(capacity))
+    , mCells(new Cell[capacity])
+    , mHead(0)
+    , mTail(0)
+    {
+        for (std::size_t i = 0; i < mCapacity; i++) {
+            mCells[i].turn.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Returns the capacity of the queue.
+     *
+     * @return The capacity provided at construction.
+     * @since 2.1.0
+     */
+    std::size_t
+    capacity() const
+    {
+        return mCapacity;
+    }
+
+    /**
+     * Appends an element, unless the queue is full.
+     *
+     * @param element The element, moved into the queue on success.
+     * @return <b>false</b> if the queue is full, in which case element is left
+     * unchanged.
+     * @since 2.1.0
+     */
+    bool
+    tryPush(T& element)
+    {
+        std::size_t head = mHead.load(std::memory_order_acquire);
+
+        while (true) {
+            Cell& cell = mCells[head % mCapacity];
+            const std::size_t turn = 2 * (head / mCapacity);
+
+            if (cell.turn.load(std::memory_order_acquire) == turn) {
+                if (mHead.compare_exchange_strong(head, head + 1)) {
+                    cell.value = std::move(element);
+                    cell.turn.store(turn + 1, std::memory_order_release);
+                    return true;
+                }
+            } else {
+                const std::size_t previousHead = head;
+                head = mHead.load(std::memory_order_acquire);
+                if (head == previousHead) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    /**
+     * Removes the oldest element, unless the queue is empty.
+     *
+     * @param element Replaced by the removed element on success.
+     * @return <b>false</b> if the queue is empty.
+     * @since 2.1.0
+     */
+    bool
+    tryPop(T& element)
+    {
+        std::size_t tail = mTail.load(std::memory_order_acquire);
+
+        while (true) {
+            Cell& cell = mCells[tail % mCapacity];
+            const std::size_t turn = 2 * (tail / mCapacity) + 1;
+
+            if (cell.turn.load(std::memory_order_acquire) == turn) {
+                if (mTail.compare_exchange_strong(tail, tail + 1)) {
+                    element = std::move(cell.value);
+                    cell.value = T();
+                    cell.turn.store(turn + 1, std::memory_order_release);
+                    return true;
+                }
+            } else {
+                const std::size_t previousTail = tail;
+                tail = mTail.load(std::memory_order_acquire);
+                if (tail == previousTail) {
+                    return false;
+                }
+            }
+        }
+    }
+
+private:
+    /**
+     *
+     */
+    struct Cell {
+        std::atomic<std::size_t> turn;
+        T value;
+    };
+
+    /**
+     *
+     */
+    static std::size_t
+    checkCapacity(const std::size_t capacity)
+    {
+        if (capacity == 0) {
+            throw std::invalid_argument("Queue capacity is 0");
+        }
+
+        return capacity;
+    }
+
+    /**
+     *
+     */
+    const std::size_t mCapacity;
+
+    /**
+     *
+     */
+    const std::unique_ptr<Cell[]> mCells;
+
+    /**
+     * Padding keeping the producer and consumer positions on distinct cache
+     * lines.
+     */
+    char mPadding0[64];
+
+    /**
+     * Position of the next push.
+     */
+    std::atomic<std::size_t> mHead;
+
+    /**
+     *
+     */
+    char mPadding1[64];
+
+    /**
+     * Position of the next pop.
+     */
+    std::atomic<std::size_t> mTail;
+};
+
+} /* namespace cpp */
+} /* namespace reader */
+} /* namespace keypop */
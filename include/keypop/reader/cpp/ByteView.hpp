@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace keypop {
+namespace reader {
+namespace cpp {
+
+/**
+ * Non-owning read-only view of a contiguous sequence of bytes.
+ *
+ * <p>A view is a (pointer, length) pair: creating or copying it never
+ * allocates nor copies the viewed bytes. It remains valid as long as the
+ * object owning the bytes is alive and unmodified.
+ *
+ * @since 2.1.0
+ */
+class ByteView final {
+public:
+    /**
+     * Creates an empty view.
+     *
+     * @since 2.1.0
+     */
+    ByteView() : mData(nullptr), mSize(0) {}
+
+    /**
+     * Creates a view of raw bytes.
+     *
+     * @param data A pointer to the first byte, may be null if size is 0.
+     * @param size The number of bytes.
+     * @since 2.1.0
+     */
+    ByteView(const std::uint8_t* data, const std::size_t size)
+    : mData(data), mSize(size)
+    {
+    }
+
+    /**
+     * Creates a view of the content of a byte array.
+     *
+     * @param bytes The byte array, which must outlive the view.
+     * @since 2.1.0
+     */
+    explicit ByteView(const std::vector<std::uint8_t>& bytes)
+    : mData(bytes.data()), mSize(bytes.size())
+    {
+    }
+
+    /**
+     * @return A pointer to the first byte, possibly null if the view is empty.
+     * @since 2.1.0
+     */
+    const std::uint8_t*
+    data() const
+    {
+        return mData;
+    }
+
+    /**
+     * @return The number of bytes.
+     * @since 2.1.0
+     */
+    std::size_t
+    size() const
+    {
+        return mSize;
+    }
+
+    /**
+     * @return <b>true</b> if the view contains no byte.
+     * @since 2.1.0
+     */
+    bool
+    empty() const
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * @param index The index of the byte, lower than size().
+     * @return The byte at the provided index.
+     * @since 2.1.0
+     */
+    std::uint8_t
+    operator[](const std::size_t index) const
+    {
+        return mData[index];
+    }
+
+    /**
+     * @return An iterator to the first byte.
+     * @since 2.1.0
+     */
+    const std::uint8_t*
+    begin() const
+    {
+        return mData;
+    }
+
+    /**
+     * @return An iterator past the last byte.
+     * @since 2.1.0
+     */
+    const std::uint8_t*
+    end() const
+    {
+        return mData + mSize;
+    }
+
+    /**
+     * Returns a copy of the viewed bytes.
+     *
+     * @return A new byte array.
+     * @since 2.1.0
+     */
+    std::vector<std::uint8_t>
+    toVector() const
+    {
+        return std::vector<std::uint8_t>(begin(), end());
+    }
+
+private:
+    /**
+     *
+     */
+    const std::uint8_t* mData;
+
+    /**
+     *
+     */
+    std::size_t mSize;
+};
+
+} /* namespace cpp */
+} /* namespace reader */
+} /* namespace keypop */
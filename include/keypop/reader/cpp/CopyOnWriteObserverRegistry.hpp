@@ -0,0 +1,285 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace keypop {
+namespace reader {
+namespace cpp {
+
+/**
+ * Copy-on-write observer registry, reference implementation of the observer
+ * list behind keypop::reader::ObservableCardReader#addObserver(),
+ * removeObserver(), clearObservers() and countObservers().
+ *
+ * <p>The observers are held in an immutable list published through a
+ * std::shared_ptr. Event delivery takes a snapshot of the current list with a
+ * single atomic load and walks it without any lock, so that it is never
+ * blocked by a subscription and never copies the list. Each mutation copies
+ * the list, applies the change and publishes the new list atomically; the
+ * mutations are serialized by a mutex that delivery never takes. A snapshot
+ * remains valid, and unchanged, for as long as it is held: an observer
+ * removed during a delivery may therefore still receive the event in
+ * progress.
+ *
+ * <p>Each observer is registered with the mask of the event types it
+ * subscribed to, and each list carries the union of these masks: an event
+ * whose type no observer subscribed to is rejected by isObserved() with a
+ * single test, before being built.
+ *
+ * <p>The atomic operations on std::shared_ptr are lock-free only if the
+ * standard library makes them so; libstdc++ for instance protects them with a
+ * small pool of internal spin locks held for a few instructions. This still
+ * avoids any contention on a registry-wide lock during delivery.
+ *
+ * @param <T> The observer type, e.g.
+ * keypop::reader::spi::CardReaderObserverSpi.
+ * @since 2.1.0
+ */
+template <typename T>
+class CopyOnWriteObserverRegistry final {
+public:
+    /**
+     * Registered observer and the event types it subscribed to.
+     *
+     * @since 2.1.0
+     */
+    struct Registration {
+        /**
+         * The observer.
+         */
+        std::shared_ptr<T> observer;
+
+        /**
+         * The event types, as a keypop::reader::CardReaderEvent::TypeMask.
+         */
+        std::uint32_t eventTypeMask;
+    };
+
+    /**
+     * Immutable list of observers.
+     *
+     * @since 2.1.0
+     */
+    struct ObserverList {
+        /**
+         * The registrations, in the order of registration.
+         */
+        std::vector<Registration> registrations;
+
+        /**
+         * Union of the event type masks of all the registrations.
+         */
+        std::uint32_t eventTypeMask;
+    };
+
+    /**
+     * Creates an empty registry.
+     *
+     * @since 2.1.0
+     */
+    CopyOnWriteObserverRegistry() : mObservers(std::make_shared<ObserverList>())
+    {
+    }
+
+    /**
+     * Registers an observer, or updates the event types of an observer
+     * already registered.
+     *
+     * @param observer The observer (should be not null).
+     * @param eventTypeMask The event types the observer subscribes to, all by
+     * default.
+     * @return <b>false</b> if the observer was already registered.
+     * @since 2.1.0
+     */
+    bool
+    add(
+        const std::shared_ptr<T>& observer,
+        const std::uint32_t eventTypeMask = ~0u)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        const std::shared_ptr<const ObserverList> current = snapshot();
+        const std::shared_ptr<ObserverList> updated
+            = std::make_shared<ObserverList>();
+        updated->registrations.reserve(current->registrations.size() + 1);
+
+        bool found = false;
+        for (const Registration& registration : current->registrations) {
+            updated->registrations.push_back(registration);
+            if (registration.observer == observer) {
+                updated->registrations.back().eventTypeMask = eventTypeMask;
+                found = true;
+            }
+        }
+        if (!found) {
+            updated->registrations.push_back(
+                Registration{observer, eventTypeMask});
+        }
+        publish(updated);
+
+        return !found;
+    }
+
+    /**
+     * Unregisters an observer.
+     *
+     * @param observer The observer.
+     * @return <b>false</b> if the observer was not registered.
+     * @since 2.1.0
+     */
+    bool
+    remove(const std::shared_ptr<T>& observer)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        const std::shared_ptr<const ObserverList> current = snapshot();
+        const std::shared_ptr<ObserverList> updated
+            = std::make_shared<ObserverList>();
+        updated->registrations.reserve(current->registrations.size());
+
+        for (const Registration& registration : current->registrations) {
+            if (registration.observer != observer) {
+                updated->registrations.push_back(registration);
+            }
+        }
+        if (updated->registrations.size() == current->registrations.size()) {
+            return false;
+        }
+        publish(updated);
+
+        return true;
+    }
+
+    /**
+     * Unregisters all the observers.
+     *
+     * @since 2.1.0
+     */
+    void
+    clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        publish(std::make_shared<ObserverList>());
+    }
+
+    /**
+     * Returns the number of registered observers.
+     *
+     * @return A non-negative int.
+     * @since 2.1.0
+     */
+    int
+    size() const
+    {
+        return static_cast<int>(snapshot()->registrations.size());
+    }
+
+    /**
+     * Indicates whether at least one observer subscribed to one of the
+     * provided event types, so that the event does not need to be built
+     * otherwise.
+     *
+     * @param eventTypeMask The event types.
+     * @return <b>true</b> if the event has at least one recipient.
+     * @since 2.1.0
+     */
+    bool
+    isObserved(const std::uint32_t eventTypeMask) const
+    {
+        return (snapshot()->eventTypeMask & eventTypeMask) != 0;
+    }
+
+    /**
+     * Returns the current list of observers.
+     *
+     * @return A non-null list, never modified afterwards.
+     * @since 2.1.0
+     */
+    std::shared_ptr<const ObserverList>
+    snapshot() const
+    {
+        return std::atomic_load(&mObservers);
+    }
+
+    /**
+     * Invokes the provided function for each observer of the current list
+     * subscribed to one of the provided event types, in the order of
+     * registration, without taking any lock.
+     *
+     * @param eventTypeMask The event types, all by default.
+     * @param function The function, taking a const std::shared_ptr<T>&.
+     * @since 2.1.0
+     */
+    template <typename Function>
+    void
+    forEach(const std::uint32_t eventTypeMask, Function function) const
+    {
+        const std::shared_ptr<const ObserverList> observers = snapshot();
+        if ((observers->eventTypeMask & eventTypeMask) == 0) {
+            return;
+        }
+        for (const Registration& registration : observers->registrations) {
+            if ((registration.eventTypeMask & eventTypeMask) != 0) {
+                function(registration.observer);
+            }
+        }
+    }
+
+    /**
+     * Invokes the provided function for each observer of the current list,
+     * whatever its event types.
+     *
+     * @param function The function, taking a const std::shared_ptr<T>&.
+     * @since 2.1.0
+     */
+    template <typename Function>
+    void
+    forEach(Function function) const
+    {
+        forEach(~0u, function);
+    }
+
+private:
+    /**
+     * Computes the union of the masks and publishes the list.
+     */
+    void
+    publish(const std::shared_ptr<ObserverList>& observers)
+    {
+        observers->eventTypeMask = 0;
+        for (const Registration& registration : observers->registrations) {
+            observers->eventTypeMask |= registration.eventTypeMask;
+        }
+
+        std::atomic_store(
+            &mObservers, std::shared_ptr<const ObserverList>(observers));
+    }
+
+    /**
+     * Serializes the mutations.
+     */
+    std::mutex mMutex;
+
+    /**
+     * Current list, only accessed through atomic operations.
+     */
+    std::shared_ptr<const ObserverList> mObservers;
+};
+
+} /* namespace cpp */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,303 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)                                       \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define KEYPOP_READER_HEX_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define KEYPOP_READER_HEX_NEON
+#endif
+
+namespace keypop {
+namespace reader {
+namespace cpp {
+
+/**
+ * Reference hexadecimal codec, available to the implementations of the API
+ * for their hexadecimal entry points (DF names, power-on data, exported
+ * scenarios).
+ *
+ * <p>Encoding produces upper case digits. Decoding accepts upper and lower case
+ * digits. Blocks of 16 bytes are processed with SSE2 or AArch64 NEON
+ * instructions when available, the remaining bytes with a scalar loop.
+ *
+ * @since 2.1.0
+ */
+class HexUtil final {
+public:
+    /**
+     * Encodes bytes to hexadecimal digits.
+     *
+     * @param src A pointer to the first byte to encode.
+     * @param length The number of bytes to encode.
+     * @param dest A pointer to a buffer of at least 2 * length characters.
+     * @since 2.1.0
+     */
+    static void
+    encode(const std::uint8_t* src, const std::size_t length, char* dest)
+    {
+        std::size_t i = 0;
+
+#if defined(KEYPOP_READER_HEX_SSE2)
+        const __m128i lowNibbleMask = _mm_set1_epi8(0x0F);
+        const __m128i nine = _mm_set1_epi8(9);
+        const __m128i zeroDigit = _mm_set1_epi8('0');
+        const __m128i letterOffset = _mm_set1_epi8('A' - '0' - 10);
+
+        for (; i + 16 <= length; i += 16) {
+            const __m128i bytes
+                = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i high
+                = _mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibbleMask);
+            const __m128i low = _mm_and_si128(bytes, lowNibbleMask);
+
+            const __m128i highDigits = _mm_add_epi8(
+                _mm_add_epi8(high, zeroDigit),
+                _mm_and_si128(_mm_cmpgt_epi8(high, nine), letterOffset));
+            const __m128i lowDigits = _mm_add_epi8(
+                _mm_add_epi8(low, zeroDigit),
+                _mm_and_si128(_mm_cmpgt_epi8(low, nine), letterOffset));
+
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dest + 2 * i),
+                _mm_unpacklo_epi8(highDigits, lowDigits));
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dest + 2 * i + 16),
+                _mm_unpackhi_epi8(highDigits, lowDigits));
+        }
+#elif defined(KEYPOP_READER_HEX_NEON)
+        static const std::uint8_t digits[16]
+            = {'0', '1', '2', '3', '4', '5', '6', '7',
+               '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+        const uint8x16_t table = vld1q_u8(digits);
+
+        for (; i + 16 <= length; i += 16) {
+            const uint8x16_t bytes = vld1q_u8(src + i);
+            uint8x16x2_t out;
+            out.val[0] = vqtbl1q_u8(table, vshrq_n_u8(bytes, 4));
+            out.val[1] = vqtbl1q_u8(table, vandq_u8(bytes, vdupq_n_u8(0x0F)));
+            vst2q_u8(reinterpret_cast<std::uint8_t*>(dest + 2 * i), out);
+        }
+#endif
+
+        for (; i < length; i++) {
+            dest[2 * i] = digit(src[i] >> 4);
+            dest[2 * i + 1] = digit(src[i] & 0x0F);
+        }
+    }
+
+    /**
+     * Encodes bytes to an hexadecimal string.
+     *
+     * @param src A pointer to the first byte to encode.
+     * @param length The number of bytes to encode.
+     * @return A string of 2 * length upper case hexadecimal digits.
+     * @since 2.1.0
+     */
+    static std::string
+    toHex(const std::uint8_t* src, const std::size_t length)
+    {
+        std::string hex(2 * length, '\0');
+        if (length > 0) {
+            encode(src, length, &hex[0]);
+        }
+
+        return hex;
+    }
+
+    /**
+     * Encodes bytes to an hexadecimal string.
+     *
+     * @param src The bytes to encode.
+     * @return A string of upper case hexadecimal digits.
+     * @since 2.1.0
+     */
+    static std::string
+    toHex(const std::vector<std::uint8_t>& src)
+    {
+        return toHex(src.data(), src.size());
+    }
+
+    /**
+     * Decodes hexadecimal digits to bytes.
+     *
+     * @param src A pointer to the first digit to decode.
+     * @param length The number of digits to decode.
+     * @param dest A pointer to a buffer of at least length / 2 bytes.
+     * @return <b>false</b> if the length is odd or a character is not an
+     * hexadecimal digit, in which case the content of dest is unspecified.
+     * @since 2.1.0
+     */
+    static bool
+    decode(const char* src, const std::size_t length, std::uint8_t* dest)
+    {
+        if (length % 2 != 0) {
+            return false;
+        }
+
+        const std::size_t byteCount = length / 2;
+        std::size_t i = 0;
+
+#if defined(KEYPOP_READER_HEX_SSE2)
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+        const __m128i zeroDigit = _mm_set1_epi8('0');
+        const __m128i aLetter = _mm_set1_epi8('a');
+        const __m128i belowZero = _mm_set1_epi8('0' - 1);
+        const __m128i aboveNine = _mm_set1_epi8('9' + 1);
+        const __m128i belowA = _mm_set1_epi8('a' - 1);
+        const __m128i aboveF = _mm_set1_epi8('f' + 1);
+        const __m128i ten = _mm_set1_epi8(10);
+        const __m128i lowByteMask = _mm_set1_epi16(0x00FF);
+
+        for (; i + 16 <= byteCount; i += 16) {
+            const __m128i chars[2]
+                = {_mm_loadu_si128(
+                       reinterpret_cast<const __m128i*>(src + 2 * i)),
+                   _mm_loadu_si128(
+                       reinterpret_cast<const __m128i*>(src + 2 * i + 16))};
+            __m128i values[2];
+
+            for (int k = 0; k < 2; k++) {
+                const __m128i c = chars[k];
+                const __m128i lower = _mm_or_si128(c, caseBit);
+                const __m128i isDigit = _mm_and_si128(
+                    _mm_cmpgt_epi8(c, belowZero), _mm_cmplt_epi8(c, aboveNine));
+                const __m128i isLetter = _mm_and_si128(
+                    _mm_cmpgt_epi8(lower, belowA),
+                    _mm_cmplt_epi8(lower, aboveF));
+
+                if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter))
+                    != 0xFFFF) {
+                    return false;
+                }
+
+                values[k] = _mm_or_si128(
+                    _mm_and_si128(isDigit, _mm_sub_epi8(c, zeroDigit)),
+                    _mm_and_si128(
+                        isLetter,
+                        _mm_add_epi8(_mm_sub_epi8(lower, aLetter), ten)));
+            }
+
+            /* Combine each pair of nibbles (high at even index, low at odd) */
+            __m128i bytes[2];
+            for (int k = 0; k < 2; k++) {
+                bytes[k] = _mm_or_si128(
+                    _mm_slli_epi16(_mm_and_si128(values[k], lowByteMask), 4),
+                    _mm_srli_epi16(values[k], 8));
+            }
+
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dest + i),
+                _mm_packus_epi16(
+                    _mm_and_si128(bytes[0], lowByteMask),
+                    _mm_and_si128(bytes[1], lowByteMask)));
+        }
+#elif defined(KEYPOP_READER_HEX_NEON)
+        for (; i + 16 <= byteCount; i += 16) {
+            const uint8x16x2_t chars
+                = vld2q_u8(reinterpret_cast<const std::uint8_t*>(src + 2 * i));
+            uint8x16_t nibbles[2];
+
+            for (int k = 0; k < 2; k++) {
+                const uint8x16_t c = chars.val[k];
+                const uint8x16_t digitValue = vsubq_u8(c, vdupq_n_u8('0'));
+                const uint8x16_t letterValue = vsubq_u8(
+                    vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+                const uint8x16_t isDigit = vcltq_u8(digitValue, vdupq_n_u8(10));
+                const uint8x16_t isLetter
+                    = vcltq_u8(letterValue, vdupq_n_u8(6));
+
+                if (vminvq_u8(vorrq_u8(isDigit, isLetter)) == 0) {
+                    return false;
+                }
+
+                nibbles[k] = vbslq_u8(
+                    isDigit,
+                    digitValue,
+                    vaddq_u8(letterValue, vdupq_n_u8(10)));
+            }
+
+            vst1q_u8(
+                dest + i, vorrq_u8(vshlq_n_u8(nibbles[0], 4), nibbles[1]));
+        }
+#endif
+
+        for (; i < byteCount; i++) {
+            const int high = value(src[2 * i]);
+            const int low = value(src[2 * i + 1]);
+            if (high < 0 || low < 0) {
+                return false;
+            }
+            dest[i] = static_cast<std::uint8_t>((high << 4) | low);
+        }
+
+        return true;
+    }
+
+    /**
+     * Decodes an hexadecimal string to bytes.
+     *
+     * @param hex The hexadecimal string.
+     * @param dest Replaced by the decoded bytes.
+     * @return <b>false</b> if the length is odd or a character is not an
+     * hexadecimal digit, in which case the content of dest is unspecified.
+     * @since 2.1.0
+     */
+    static bool
+    fromHex(const std::string& hex, std::vector<std::uint8_t>& dest)
+    {
+        dest.resize(hex.size() / 2);
+
+        return decode(hex.data(), hex.size(), dest.data());
+    }
+
+private:
+    /**
+     * Returns the upper case digit of a nibble.
+     */
+    static char
+    digit(const int nibble)
+    {
+        return static_cast<char>(
+            nibble < 10 ? '0' + nibble : 'A' + nibble - 10);
+    }
+
+    /**
+     * Returns the value of an hexadecimal digit, -1 if invalid.
+     */
+    static int
+    value(const char c)
+    {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'A' && c <= 'F') {
+            return c - 'A' + 10;
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        }
+
+        return -1;
+    }
+};
+
+} /* namespace cpp */
+} /* namespace reader */
+} /* namespace keypop */
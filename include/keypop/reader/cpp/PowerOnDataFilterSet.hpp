@@ -0,0 +1,233 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "keypop/reader/cpp/PowerOnDataMaskMatcher.hpp"
+
+namespace keypop {
+namespace reader {
+namespace cpp {
+
+/**
+ * Combined evaluation of the power-on data filters of all the selection cases
+ * of a scenario.
+ *
+ * <p>The filters are grouped by mask and length range; within a group, the
+ * masked values are indexed in a hash table. A single pass over the power-on
+ * data then costs one mask operation and one lookup per distinct mask, instead
+ * of one evaluation per selection case, and yields the set of cases that can
+ * still match.
+ *
+ * <p>Selection cases are identified by the order in which they are added,
+ * starting at 0. Cases without mask filter (no power-on data filter, or a
+ * filter that cannot be evaluated here such as a regular expression or a
+ * predicate) are always reported as candidates, their remaining filters having
+ * to be evaluated by the caller. Conversely, a case whose mask filter rejects
+ * the data is not reported, whatever its remaining filters.
+ *
+ * @since 2.1.0
+ */
+class PowerOnDataFilterSet final {
+public:
+    /**
+     * Adds a selection case whose power-on data filter is the provided matcher.
+     *
+     * @param matcher The power-on data filter of the case.
+     * @return The index of the case.
+     * @since 2.1.0
+     */
+    int
+    addCase(const PowerOnDataMaskMatcher& matcher)
+    {
+        const int index = mCaseCount++;
+
+        Group* group = nullptr;
+        for (auto& candidate : mGroups) {
+            if (candidate.hasSameShape(matcher)) {
+                group = &candidate;
+                break;
+            }
+        }
+
+        if (group == nullptr) {
+            mGroups.push_back(Group(matcher));
+            group = &mGroups.back();
+        }
+
+        group->mCases[Key(matcher.mValue)].push_back(index);
+
+        return index;
+    }
+
+    /**
+     * Adds a selection case that cannot be rejected on its power-on data.
+     *
+     * @return The index of the case.
+     * @since 2.1.0
+     */
+    int
+    addCase()
+    {
+        const int index = mCaseCount++;
+        mUnfilteredCases.push_back(index);
+
+        return index;
+    }
+
+    /**
+     * Returns the number of selection cases added.
+     *
+     * @return A non-negative int.
+     * @since 2.1.0
+     */
+    int
+    getCaseCount() const
+    {
+        return mCaseCount;
+    }
+
+    /**
+     * Evaluates the provided power-on data against all the filters at once.
+     *
+     * @param powerOnData A pointer to the first byte of the power-on data.
+     * @param length The number of bytes of the power-on data.
+     * @param candidates Replaced by a vector of getCaseCount() flags, set for
+     * the cases that can still match the power-on data, including all the
+     * cases without mask filter.
+     * @since 2.1.0
+     */
+    void
+    match(
+        const std::uint8_t* powerOnData,
+        const std::size_t length,
+        std::vector<bool>& candidates) const
+    {
+        candidates.assign(static_cast<std::size_t>(mCaseCount), false);
+
+        for (const int index : mUnfilteredCases) {
+            candidates[static_cast<std::size_t>(index)] = true;
+        }
+
+        for (const auto& group : mGroups) {
+            if (length < group.mMinLength || length > group.mMaxLength
+                || length < group.mPatternLength) {
+                continue;
+            }
+
+            Key key;
+            if (group.mPatternLength > 0) {
+                std::memcpy(key.mWords, powerOnData, group.mPatternLength);
+            }
+            for (std::size_t i = 0; i < PowerOnDataMaskMatcher::WORD_COUNT;
+                 i++) {
+                key.mWords[i] &= group.mMask[i];
+            }
+
+            const auto it = group.mCases.find(key);
+            if (it != group.mCases.end()) {
+                for (const int index : it->second) {
+                    candidates[static_cast<std::size_t>(index)] = true;
+                }
+            }
+        }
+    }
+
+private:
+    /**
+     * Masked value, used as hash table key.
+     */
+    struct Key {
+        Key() : mWords() {}
+
+        explicit Key(
+            const std::uint64_t (&words)[PowerOnDataMaskMatcher::WORD_COUNT])
+        {
+            std::memcpy(mWords, words, sizeof(mWords));
+        }
+
+        bool
+        operator==(const Key& other) const
+        {
+            return std::memcmp(mWords, other.mWords, sizeof(mWords)) == 0;
+        }
+
+        std::uint64_t mWords[PowerOnDataMaskMatcher::WORD_COUNT];
+    };
+
+    /**
+     *
+     */
+    struct KeyHash {
+        std::size_t
+        operator()(const Key& key) const
+        {
+            std::uint64_t hash = 0xCBF29CE484222325ULL;
+            for (const std::uint64_t word : key.mWords) {
+                hash = (hash ^ word) * 0x100000001B3ULL;
+            }
+
+            return static_cast<std::size_t>(hash ^ (hash >> 32));
+        }
+    };
+
+    /**
+     * Filters sharing the same mask, pattern length and length range.
+     */
+    struct Group {
+        explicit Group(const PowerOnDataMaskMatcher& matcher)
+        : mPatternLength(matcher.mPatternLength),
+          mMinLength(matcher.mMinLength),
+          mMaxLength(matcher.mMaxLength)
+        {
+            std::memcpy(mMask, matcher.mMask, sizeof(mMask));
+        }
+
+        bool
+        hasSameShape(const PowerOnDataMaskMatcher& matcher) const
+        {
+            return mPatternLength == matcher.mPatternLength
+                   && mMinLength == matcher.mMinLength
+                   && mMaxLength == matcher.mMaxLength
+                   && std::memcmp(mMask, matcher.mMask, sizeof(mMask)) == 0;
+        }
+
+        std::size_t mPatternLength;
+        std::size_t mMinLength;
+        std::size_t mMaxLength;
+        std::uint64_t mMask[PowerOnDataMaskMatcher::WORD_COUNT];
+        std::unordered_map<Key, std::vector<int>, KeyHash> mCases;
+    };
+
+    /**
+     *
+     */
+    int mCaseCount = 0;
+
+    /**
+     *
+     */
+    std::vector<int> mUnfilteredCases;
+
+    /**
+     *
+     */
+    std::vector<Group> mGroups;
+};
+
+} /* namespace cpp */
+} /* namespace reader */
+} /* namespace keypop */
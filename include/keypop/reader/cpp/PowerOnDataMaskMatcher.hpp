@@ -0,0 +1,225 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace keypop {
+namespace reader {
+namespace cpp {
+
+/**
+ * Reference implementation of the power-on data filter defined by
+ * keypop::reader::selection::CardSelector
+ * ::filterByPowerOnDataMask(const std::vector<std::uint8_t>&, const
+ * std::vector<std::uint8_t>&) and
+ * keypop::reader::selection::CardSelector
+ * ::filterByPowerOnDataLength(std::size_t, std::size_t).
+ *
+ * <p>The power-on data match if their length is within the length range and
+ * if, for each index i of the pattern, (powerOnData[i] & mask[i]) equals
+ * (value[i] & mask[i]).
+ *
+ * <p>The pattern is stored as a few 64-bit words so that the evaluation costs a
+ * handful of word operations, without allocation.
+ *
+ * @since 2.1.0
+ */
+class PowerOnDataMaskMatcher final {
+public:
+    enum : std::size_t {
+        /**
+         * Maximum length of a pattern, i.e. the maximum length of an ATR as
+         * defined by ISO7816-3.
+         *
+         * @since 2.1.0
+         */
+        MAX_PATTERN_LENGTH = 33
+    };
+
+    /**
+     * Creates a matcher accepting any power-on data.
+     *
+     * @since 2.1.0
+     */
+    PowerOnDataMaskMatcher()
+    : mPatternLength(0),
+      mMinLength(0),
+      mMaxLength(std::numeric_limits<std::size_t>::max()),
+      mValue(),
+      mMask()
+    {
+    }
+
+    /**
+     * Creates a matcher from a value and a mask of the same length.
+     *
+     * @param value The expected power-on data bytes.
+     * @param mask The mask of the significant bits of value.
+     * @throw std::invalid_argument If value and mask are empty, have different
+     * lengths or are longer than MAX_PATTERN_LENGTH.
+     * @since 2.1.0
+     */
+    PowerOnDataMaskMatcher(
+        const std::vector<std::uint8_t>& value,
+        const std::vector<std::uint8_t>& mask)
+    : PowerOnDataMaskMatcher()
+    {
+        setPattern(value, mask);
+    }
+
+    /**
+     * Sets the pattern, replacing the previous one.
+     *
+     * @param value The expected power-on data bytes.
+     * @param mask The mask of the significant bits of value.
+     * @throw std::invalid_argument If value and mask are empty, have different
+     * lengths or are longer than MAX_PATTERN_LENGTH.
+     * @since 2.1.0
+     */
+    void
+    setPattern(
+        const std::vector<std::uint8_t>& value,
+        const std::vector<std::uint8_t>& mask)
+    {
+        if (value.empty() || mask.empty()) {
+            throw std::invalid_argument("Value and mask must not be empty");
+        }
+
+        if (value.size() != mask.size()) {
+            throw std::invalid_argument(
+                "Value and mask must have the same length");
+        }
+
+        if (value.size() > MAX_PATTERN_LENGTH) {
+            throw std::invalid_argument("Pattern is too long");
+        }
+
+        std::uint8_t maskedValue[WORD_COUNT * sizeof(std::uint64_t)] = {0};
+        std::uint8_t maskBytes[WORD_COUNT * sizeof(std::uint64_t)] = {0};
+        for (std::size_t i = 0; i < value.size(); i++) {
+            maskedValue[i] = static_cast<std::uint8_t>(value[i] & mask[i]);
+            maskBytes[i] = mask[i];
+        }
+
+        std::memcpy(mValue, maskedValue, sizeof(mValue));
+        std::memcpy(mMask, maskBytes, sizeof(mMask));
+        mPatternLength = value.size();
+    }
+
+    /**
+     * Sets the allowed length range of the power-on data.
+     *
+     * @param minLength The minimum length (inclusive).
+     * @param maxLength The maximum length (inclusive).
+     * @throw std::invalid_argument If minLength is greater than maxLength.
+     * @since 2.1.0
+     */
+    void
+    setLengthRange(const std::size_t minLength, const std::size_t maxLength)
+    {
+        if (minLength > maxLength) {
+            throw std::invalid_argument("Invalid length range");
+        }
+
+        mMinLength = minLength;
+        mMaxLength = maxLength;
+    }
+
+    /**
+     * Evaluates the provided power-on data.
+     *
+     * @param powerOnData A pointer to the first byte of the power-on data.
+     * @param length The number of bytes of the power-on data.
+     * @return <b>true</b> if the power-on data match the pattern and the
+     * length range.
+     * @since 2.1.0
+     */
+    bool
+    matches(const std::uint8_t* powerOnData, const std::size_t length) const
+    {
+        if (length < mMinLength || length > mMaxLength
+            || length < mPatternLength) {
+            return false;
+        }
+
+        std::uint64_t data[WORD_COUNT] = {0};
+        if (mPatternLength > 0) {
+            std::memcpy(data, powerOnData, mPatternLength);
+        }
+
+        std::uint64_t diff = 0;
+        for (std::size_t i = 0; i < WORD_COUNT; i++) {
+            diff |= (data[i] & mMask[i]) ^ mValue[i];
+        }
+
+        return diff == 0;
+    }
+
+    /**
+     * Evaluates the provided power-on data.
+     *
+     * @param powerOnData The power-on data.
+     * @return <b>true</b> if the power-on data match the pattern and the
+     * length range.
+     * @since 2.1.0
+     */
+    bool
+    matches(const std::vector<std::uint8_t>& powerOnData) const
+    {
+        return matches(powerOnData.data(), powerOnData.size());
+    }
+
+private:
+    friend class PowerOnDataFilterSet;
+
+    enum : std::size_t {
+        /**
+         * Number of 64-bit words needed to hold MAX_PATTERN_LENGTH bytes.
+         */
+        WORD_COUNT = (MAX_PATTERN_LENGTH + sizeof(std::uint64_t) - 1)
+                     / sizeof(std::uint64_t)
+    };
+
+    /**
+     *
+     */
+    std::size_t mPatternLength;
+
+    /**
+     *
+     */
+    std::size_t mMinLength;
+
+    /**
+     *
+     */
+    std::size_t mMaxLength;
+
+    /**
+     * Value bytes already masked, zero padded.
+     */
+    std::uint64_t mValue[WORD_COUNT];
+
+    /**
+     * Mask bytes, zero padded.
+     */
+    std::uint64_t mMask[WORD_COUNT];
+};
+
+} /* namespace cpp */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,332 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "keypop/reader/cpp/HexUtil.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)                                       \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define KEYPOP_READER_AID_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define KEYPOP_READER_AID_NEON
+#endif
+
+namespace keypop {
+namespace reader {
+namespace selection {
+
+/**
+ * Application identifier (AID) as defined by ISO7816-4, i.e. a DF name of 5 to
+ * 16 bytes.
+ *
+ * <p>The bytes are stored inline in a fixed 16-byte buffer, so that an Aid can
+ * be created, copied, compared and hashed without any heap allocation. The
+ * prefix comparison used to match DF names (startsWith(const Aid&)) is
+ * performed with a single 16-byte vector operation when SSE2 or NEON is
+ * available.
+ *
+ * @since 2.1.0
+ */
+class Aid final {
+public:
+    enum : std::size_t {
+        /**
+         * Minimum length of an AID in bytes.
+         *
+         * @since 2.1.0
+         */
+        MIN_LENGTH = 5,
+
+        /**
+         * Maximum length of an AID in bytes.
+         *
+         * @since 2.1.0
+         */
+        MAX_LENGTH = 16
+    };
+
+    /**
+     * Creates an empty AID, only meaningful as a placeholder.
+     *
+     * @since 2.1.0
+     */
+    Aid() : mBytes(), mLength(0) {}
+
+    /**
+     * Creates an AID from raw bytes.
+     *
+     * @param bytes A pointer to the first byte of the AID.
+     * @param length The number of bytes of the AID.
+     * @throw std::invalid_argument If the length is out of range.
+     * @since 2.1.0
+     */
+    Aid(const std::uint8_t* bytes, const std::size_t length)
+    : mBytes(), mLength(0)
+    {
+        if (length < MIN_LENGTH || length > MAX_LENGTH) {
+            throw std::invalid_argument("AID length out of range");
+        }
+
+        std::memcpy(mBytes, bytes, length);
+        mLength = static_cast<std::uint8_t>(length);
+    }
+
+    /**
+     * Creates an AID from a byte array.
+     *
+     * @param bytes The AID as a byte array containing 5 to 16 bytes.
+     * @throw std::invalid_argument If the length is out of range.
+     * @since 2.1.0
+     */
+    explicit Aid(const std::vector<std::uint8_t>& bytes)
+    : Aid(bytes.data(), bytes.size())
+    {
+    }
+
+    /**
+     * Creates an AID from a hexadecimal string.
+     *
+     * @param hex The AID as a hexadecimal string of 5 to 16 bytes.
+     * @throw std::invalid_argument If the string is not a valid hexadecimal
+     * string or its length is out of range.
+     * @since 2.1.0
+     */
+    explicit Aid(const std::string& hex) : mBytes(), mLength(0)
+    {
+        if (hex.size() % 2 != 0 || hex.size() < 2 * MIN_LENGTH
+            || hex.size() > 2 * MAX_LENGTH) {
+            throw std::invalid_argument("AID length out of range");
+        }
+
+        if (!cpp::HexUtil::decode(hex.data(), hex.size(), mBytes)) {
+            throw std::invalid_argument("Invalid hexadecimal AID");
+        }
+
+        mLength = static_cast<std::uint8_t>(hex.size() / 2);
+    }
+
+    /**
+     * Returns a pointer to the bytes of the AID.
+     *
+     * @return A non-null pointer to size() bytes.
+     * @since 2.1.0
+     */
+    const std::uint8_t*
+    data() const
+    {
+        return mBytes;
+    }
+
+    /**
+     * Returns the length of the AID in bytes.
+     *
+     * @return 0 for an empty AID, a value between 5 and 16 otherwise.
+     * @since 2.1.0
+     */
+    std::size_t
+    size() const
+    {
+        return mLength;
+    }
+
+    /**
+     * Indicates whether the AID is empty.
+     *
+     * @return <b>true</b> if the AID was default constructed.
+     * @since 2.1.0
+     */
+    bool
+    empty() const
+    {
+        return mLength == 0;
+    }
+
+    /**
+     * Returns a copy of the AID bytes.
+     *
+     * @return A new byte array.
+     * @since 2.1.0
+     */
+    std::vector<std::uint8_t>
+    toVector() const
+    {
+        return std::vector<std::uint8_t>(mBytes, mBytes + mLength);
+    }
+
+    /**
+     * Indicates whether the AID starts with the provided prefix, i.e. whether a
+     * DF name equal to this AID is selected by the prefix as defined by
+     * ISO7816-4 chapter 4.2.
+     *
+     * @param prefix The prefix.
+     * @return <b>true</b> if the first bytes of the AID are those of the
+     * prefix.
+     * @since 2.1.0
+     */
+    bool
+    startsWith(const Aid& prefix) const
+    {
+        if (prefix.mLength > mLength) {
+            return false;
+        }
+
+        const std::uint8_t* const mask = prefixMask(prefix.mLength);
+
+#if defined(KEYPOP_READER_AID_SSE2)
+        const __m128i diff = _mm_and_si128(
+            _mm_xor_si128(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(mBytes)),
+                _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(prefix.mBytes))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask)));
+
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128()))
+               == 0xFFFF;
+#elif defined(KEYPOP_READER_AID_NEON)
+        const uint64x2_t diff = vreinterpretq_u64_u8(vandq_u8(
+            veorq_u8(vld1q_u8(mBytes), vld1q_u8(prefix.mBytes)),
+            vld1q_u8(mask)));
+
+        return (vgetq_lane_u64(diff, 0) | vgetq_lane_u64(diff, 1)) == 0;
+#else
+        std::uint64_t a[2];
+        std::uint64_t b[2];
+        std::uint64_t m[2];
+        std::memcpy(a, mBytes, sizeof(a));
+        std::memcpy(b, prefix.mBytes, sizeof(b));
+        std::memcpy(m, mask, sizeof(m));
+
+        return (((a[0] ^ b[0]) & m[0]) | ((a[1] ^ b[1]) & m[1])) == 0;
+#endif
+    }
+
+    /**
+     * Returns the hash code of the AID.
+     *
+     * @return A hash of the bytes and the length of the AID.
+     * @since 2.1.0
+     */
+    std::size_t
+    hashCode() const
+    {
+        std::uint64_t words[2];
+        std::memcpy(words, mBytes, sizeof(words));
+
+        std::uint64_t hash = 0xCBF29CE484222325ULL ^ mLength;
+        hash = (hash ^ words[0]) * 0x100000001B3ULL;
+        hash = (hash ^ words[1]) * 0x100000001B3ULL;
+
+        return static_cast<std::size_t>(hash ^ (hash >> 32));
+    }
+
+    /**
+     *
+     */
+    bool
+    operator==(const Aid& other) const
+    {
+        return mLength == other.mLength
+               && std::memcmp(mBytes, other.mBytes, sizeof(mBytes)) == 0;
+    }
+
+    /**
+     *
+     */
+    bool
+    operator!=(const Aid& other) const
+    {
+        return !(*this == other);
+    }
+
+    /**
+     * Lexicographical order of the bytes, a prefix being lower than the AIDs
+     * it selects.
+     */
+    bool
+    operator<(const Aid& other) const
+    {
+        const std::size_t length
+            = mLength < other.mLength ? mLength : other.mLength;
+        const int cmp = std::memcmp(mBytes, other.mBytes, length);
+
+        return cmp < 0 || (cmp == 0 && mLength < other.mLength);
+    }
+
+    /**
+     *
+     */
+    friend std::ostream&
+    operator<<(std::ostream& os, const Aid& aid)
+    {
+        char hex[2 * MAX_LENGTH];
+        cpp::HexUtil::encode(aid.mBytes, aid.mLength, hex);
+
+        os << "AID: ";
+        os.write(hex, static_cast<std::streamsize>(2 * aid.mLength));
+
+        return os;
+    }
+
+private:
+    /**
+     * Returns a 16-byte mask whose first length bytes are set.
+     */
+    static const std::uint8_t*
+    prefixMask(const std::size_t length)
+    {
+        static const std::uint8_t ones[2 * MAX_LENGTH]
+            = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+               0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+        return ones + MAX_LENGTH - length;
+    }
+
+    /**
+     * Zero padded AID bytes.
+     */
+    std::uint8_t mBytes[MAX_LENGTH];
+
+    /**
+     *
+     */
+    std::uint8_t mLength;
+};
+
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
+
+namespace std {
+
+/**
+ * Hash support allowing Aid to be used as a key of unordered containers.
+ */
+template <>
+struct hash<keypop::reader::selection::Aid> {
+    std::size_t
+    operator()(const keypop::reader::selection::Aid& aid) const
+    {
+        return aid.hashCode();
+    }
+};
+
+} /* namespace std */
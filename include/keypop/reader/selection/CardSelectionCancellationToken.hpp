@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+namespace keypop {
+namespace reader {
+namespace selection {
+
+/**
+ * Token allowing the application to interrupt the execution of a card
+ * selection scenario from another thread.
+ *
+ * <p>When the cancellation is requested, the selection case in progress is
+ * completed or abandoned at the next APDU boundary, the remaining cases are
+ * skipped and a partial CardSelectionResult is returned.
+ *
+ * <p>An instance of this interface can be obtained via the method
+ * ReaderApiFactory#createCardSelectionCancellationToken().
+ *
+ * @since 2.1.0
+ */
+class CardSelectionCancellationToken {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~CardSelectionCancellationToken() = default;
+
+    /**
+     * Requests the cancellation of the card selection scenario executions
+     * using this token.
+     *
+     * <p>This method can be called from any thread and has no effect if the
+     * cancellation was already requested.
+     *
+     * @since 2.1.0
+     */
+    virtual void cancel() = 0;
+
+    /**
+     * Indicates whether the cancellation has been requested.
+     *
+     * @return <b>true</b> if cancel() has been called.
+     * @since 2.1.0
+     */
+    virtual bool isCancellationRequested() const = 0;
+};
+
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
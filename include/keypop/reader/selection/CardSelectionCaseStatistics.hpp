@@ -0,0 +1,161 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+
+namespace keypop {
+namespace reader {
+namespace selection {
+
+/**
+ * Execution statistics of a card selection case, collected when the selection
+ * statistics mode is set.
+ *
+ * @see CardSelectionManager#setSelectionStatisticsMode()
+ * @since 2.1.0
+ */
+class CardSelectionCaseStatistics {
+public:
+    /**
+     * Possible stages at which the filters of a selection case rejected the
+     * card.
+     *
+     * @since 2.1.0
+     */
+    enum RejectionStage {
+        /**
+         * The card was not rejected.
+         *
+         * @since 2.1.0
+         */
+        NOT_REJECTED,
+
+        /**
+         * The card was rejected before the evaluation of the power-on data,
+         * i.e. by the card protocol filter.
+         *
+         * @since 2.1.0
+         */
+        BEFORE_POWER_ON_DATA_EVALUATION,
+
+        /**
+         * The card was rejected by the power-on data filter.
+         *
+         * @since 2.1.0
+         */
+        AT_POWER_ON_DATA_EVALUATION,
+
+        /**
+         * The card was rejected after the evaluation of the power-on data,
+         * i.e. during the application selection.
+         *
+         * @since 2.1.0
+         */
+        AFTER_POWER_ON_DATA_EVALUATION
+    };
+
+    /**
+     * Virtual destructor.
+     */
+    virtual ~CardSelectionCaseStatistics() = default;
+
+    /**
+     * Returns the index of the selection case.
+     *
+     * @return A non-negative int.
+     * @since 2.1.0
+     */
+    virtual int getSelectionIndex() const = 0;
+
+    /**
+     * Returns the time spent processing the selection case.
+     *
+     * @return A non-negative duration.
+     * @since 2.1.0
+     */
+    virtual std::chrono::microseconds getElapsedTime() const = 0;
+
+    /**
+     * Returns the number of APDUs exchanged with the card.
+     *
+     * @return A non-negative number.
+     * @since 2.1.0
+     */
+    virtual std::size_t getApduCount() const = 0;
+
+    /**
+     * Returns the number of bytes sent to the card.
+     *
+     * @return A non-negative number.
+     * @since 2.1.0
+     */
+    virtual std::size_t getBytesSent() const = 0;
+
+    /**
+     * Returns the number of bytes received from the card, including the status
+     * words.
+     *
+     * @return A non-negative number.
+     * @since 2.1.0
+     */
+    virtual std::size_t getBytesReceived() const = 0;
+
+    /**
+     * Returns the stage at which the card was rejected by the filters of the
+     * selection case.
+     *
+     * @return A non-null value.
+     * @since 2.1.0
+     */
+    virtual RejectionStage getRejectionStage() const = 0;
+};
+
+/**
+ * Operator << for CardSelectionCaseStatistics::RejectionStage enum to enable
+ * readable logging.
+ *
+ * @param os The output stream.
+ * @param stage The rejection stage.
+ * @return The output stream.
+ */
+inline std::ostream&
+operator<<(
+    std::ostream& os, const CardSelectionCaseStatistics::RejectionStage stage)
+{
+    switch (stage) {
+    case CardSelectionCaseStatistics::RejectionStage::NOT_REJECTED:
+        os << "NOT_REJECTED";
+        break;
+    case CardSelectionCaseStatistics::RejectionStage::
+        BEFORE_POWER_ON_DATA_EVALUATION:
+        os << "BEFORE_POWER_ON_DATA_EVALUATION";
+        break;
+    case CardSelectionCaseStatistics::RejectionStage::
+        AT_POWER_ON_DATA_EVALUATION:
+        os << "AT_POWER_ON_DATA_EVALUATION";
+        break;
+    case CardSelectionCaseStatistics::RejectionStage::
+        AFTER_POWER_ON_DATA_EVALUATION:
+        os << "AFTER_POWER_ON_DATA_EVALUATION";
+        break;
+    default:
+        os << "UNKNOWN_STAGE(" << static_cast<int>(stage) << ")";
+        break;
+    }
+    return os;
+}
+
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
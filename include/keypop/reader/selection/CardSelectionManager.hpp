@@ -10,14 +10,27 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "keypop/reader/CardReader.hpp"
 #include "keypop/reader/ObservableCardReader.hpp"
 #include "keypop/reader/cpp/CardSelectorBase.hpp"
+#include "keypop/reader/selection/CardSelectionCancellationToken.hpp"
+#include "keypop/reader/selection/CardSelectionOutcome.hpp"
 #include "keypop/reader/selection/CardSelectionResult.hpp"
+#include "keypop/reader/selection/CompiledCardSelectionScenario.hpp"
+#include "keypop/reader/selection/ProcessedCardSelectionScenario.hpp"
 #include "keypop/reader/selection/spi/CardSelectionExtension.hpp"
+#include "keypop/reader/spi/CardSelectionCompletionHandlerSpi.hpp"
+#include "keypop/reader/spi/ProcessedCardSelectionCompletionHandlerSpi.hpp"
+#include "keypop/reader/spi/SmartCardSelectionObserverSpi.hpp"
+#include "keypop/reader/spi/TaskExecutorSpi.hpp"
 
 namespace keypop {
 namespace reader {
@@ -27,6 +40,10 @@ using keypop::reader::CardReader;
 using keypop::reader::ObservableCardReader;
 using keypop::reader::cpp::CardSelectorBase;
 using keypop::reader::selection::spi::CardSelectionExtension;
+using keypop::reader::spi::CardSelectionCompletionHandlerSpi;
+using keypop::reader::spi::ProcessedCardSelectionCompletionHandlerSpi;
+using keypop::reader::spi::SmartCardSelectionObserverSpi;
+using keypop::reader::spi::TaskExecutorSpi;
 
 /**
  * Service dedicated to card selection, based on the preparation of a card
@@ -65,6 +82,18 @@ using keypop::reader::selection::spi::CardSelectionExtension;
  * presented to an observable reader.
  * </ul>
  *
+ * <p>Thread safety: the preparation methods, as well as the methods updating
+ * the last processed scenario, must not be invoked concurrently. Once the
+ * scenario is compiled, the const methods can be invoked concurrently from any
+ * number of threads; in particular executeCardSelectionScenario(const
+ * std::shared_ptr<CompiledCardSelectionScenario>, std::shared_ptr<CardReader>)
+ * allows a single manager to serve several readers at the same time. The
+ * pooled result and adaptive selection order modes, when set, also apply to
+ * these concurrent executions: the internal state they update is synchronized
+ * by the manager itself (see setPooledResultMode(const std::size_t) and
+ * setAdaptiveSelectionOrderMode()), so that no external locking is required.
+ * Like the other modes, they must be set before the executions start.
+ *
  * An instance of this interface can be obtained via the method
  * ReaderApiFactory#createCardSelectionManager().
  *
@@ -87,6 +116,199 @@ public:
      */
     virtual void setMultipleSelectionMode() = 0;
 
+    /**
+     * Sets the DF name prefix grouping mode to reduce the number of "Select
+     * Application" commands sent to the card.
+     *
+     * <p>When this mode is set, the selection cases based on ISO selectors
+     * whose DF names share a common prefix and which use the same "Select
+     * Application" P2 parameter are grouped, and the applications of the
+     * group are enumerated with a single prefix selection followed by
+     * selections of the FileOccurrence#NEXT occurrence, instead of one
+     * selection per case. The DF name returned by the card is then matched
+     * against the DF names of the grouped cases.
+     *
+     * <p>Since the cases are told apart by the DF name returned by the card, a
+     * case is eligible only if:
+     *
+     * <ul>
+     *   <li>it has a DF name filter and uses the FileOccurrence#FIRST file
+     * occurrence mode (the default one),
+     *   <li>it uses the FileControlInformation#FCI or
+     * FileControlInformation#FCP mode, whose response carries the DF name
+     * (tag 84); the cases of a group all use the same mode, since it is
+     * encoded in P2 together with the file occurrence,
+     *   <li>its card protocol and power-on data filters accept the card: these
+     * filters are checked before the case joins a group.
+     * </ul>
+     *
+     * <p>If a response of the enumeration nevertheless carries no DF name, the
+     * enumeration of the group is abandoned and its remaining cases are
+     * processed individually.
+     *
+     * <p>The grouping is an optimization only and does not change the outcome
+     * of the scenario:
+     *
+     * <ul>
+     *   <li>In single selection mode, the reported case is the earliest one in
+     * preparation order whose DF name matches an application of the card,
+     * exactly as without grouping. The enumeration stops as soon as an
+     * application matches the earliest grouped case not yet ruled out, or
+     * when the card has no further application; if the application of the
+     * reported case is not the last one selected by the enumeration, it is
+     * selected again with its full DF name. The application currently
+     * selected on the card is therefore always the one of the reported case.
+     *   <li>In multiple selection mode, the applications are enumerated until
+     * the end and every matching case is reported; the application currently
+     * selected on the card is the one of the last reported case.
+     *   <li>The results are reported in the CardSelectionResult with the
+     * selection indexes returned by prepareSelection(const
+     * std::shared_ptr<CardSelectorBase>, const
+     * std::shared_ptr<CardSelectionExtension>).
+     * </ul>
+     *
+     * <p>The cases that are not eligible, e.g. using the
+     * FileControlInformation#FMD or FileControlInformation#NO_RESPONSE mode,
+     * are not grouped and are processed as usual.
+     *
+     * <p>The DF name prefix grouping mode is disabled by default.
+     *
+     * @since 2.1.0
+     */
+    virtual void setDfNamePrefixGroupingMode() = 0;
+
+    /**
+     * Sets the adaptive selection order mode to try first the card selection
+     * cases that are the most likely to match.
+     *
+     * <p>When this mode is set, the manager counts the successful selections
+     * of each selection case and, in single selection mode, tries the cases in
+     * decreasing order of matches instead of the order of preparation. It has
+     * no effect when the multiple selection mode is set, since all the cases
+     * are then processed.
+     *
+     * <p>The reordering never changes the reported result: the reported case
+     * is always the earliest matching case in the order of preparation, as
+     * without this mode. Since several cases may match the same card (same
+     * or prefixed DF names, overlapping power-on data filters, etc.), a case
+     * is only moved ahead of the earlier cases that cannot match the same
+     * card as it; when such a case matches, the earlier cases that could
+     * also have matched are selected first, and the first of them that
+     * matches is reported instead. The selection indexes reported in the
+     * CardSelectionResult remain the ones returned by prepareSelection(const
+     * std::shared_ptr<CardSelectorBase>, const
+     * std::shared_ptr<CardSelectionExtension>).
+     *
+     * <p>When the DF name prefix grouping mode is also set (see
+     * setDfNamePrefixGroupingMode()), the groups are built first and each
+     * group is ordered as its most frequently matching case; the cases within
+     * a group keep the order of preparation, which takes precedence, as
+     * stated above, over the learned order.
+     *
+     * <p>The learned order can be saved and restored with
+     * exportSelectionOrderStatistics() and
+     * importSelectionOrderStatistics(const std::string&).
+     *
+     * <p>The mode applies to all the execution methods, including the const
+     * ones such as executeCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>) const. Concurrent executions update the
+     * match counters with atomic operations, without locking; each execution
+     * uses the order derived from the counters when it starts, which may
+     * therefore not yet reflect the matches of the executions in progress,
+     * which only affects the number of commands sent.
+     * importSelectionOrderStatistics(const std::string&) is a
+     * preparation method and must not be invoked during executions.
+     *
+     * <p>The adaptive selection order mode is disabled by default.
+     *
+     * @since 2.1.0
+     */
+    virtual void setAdaptiveSelectionOrderMode() = 0;
+
+    /**
+     * Exports the match statistics learned in adaptive selection order mode in
+     * string format.
+     *
+     * <p>This string can be imported into the same or another card selection
+     * manager configured with the same card selection scenario via the method
+     * importSelectionOrderStatistics(const std::string&).
+     *
+     * @return A non-null string.
+     * @see setAdaptiveSelectionOrderMode()
+     * @since 2.1.0
+     */
+    virtual const std::string exportSelectionOrderStatistics() const = 0;
+
+    /**
+     * Imports match statistics previously exported in string format, replacing
+     * the ones learned so far.
+     *
+     * @param selectionOrderStatistics The string containing the exported
+     * statistics.
+     * @throw IllegalArgumentException If the string is null, malformed or
+     * contains more selection cases than the current card selection scenario.
+     * @see exportSelectionOrderStatistics()
+     * @since 2.1.0
+     */
+    virtual void
+    importSelectionOrderStatistics(const std::string& selectionOrderStatistics)
+        = 0;
+
+    /**
+     * Sets the selection statistics mode to collect execution statistics for
+     * each processed card selection case.
+     *
+     * <p>When this mode is set, the time spent, the number of APDUs and bytes
+     * exchanged and the rejection stage of each case are made available by
+     * CardSelectionResult#getCardSelectionCaseStatistics(). When it is not
+     * set, no measurement is made.
+     *
+     * <p>The selection statistics mode is disabled by default.
+     *
+     * @since 2.1.0
+     */
+    virtual void setSelectionStatisticsMode() = 0;
+
+    /**
+     * Sets the pooled result mode to reuse the CardSelectionResult and
+     * SmartCard objects from one card selection to the next.
+     *
+     * <p>When this mode is set, each reader on which a scenario is processed
+     * is given its own pool of at most the provided number of results. The
+     * results return to the pool of their reader when the application
+     * releases its last reference to them, and are reused by the next
+     * selections made on that reader instead of being allocated again. The
+     * same applies to the SmartCard implementing
+     * keypop::reader::selection::spi::RecyclableSmartCard built by a card
+     * extension implementing
+     * keypop::reader::selection::spi::RecyclingCardSelectionExtension, which
+     * receives the pooled instances to fill. When the pool of a reader is
+     * empty, new objects are allocated as usual.
+     *
+     * <p>The application must therefore not keep references to the content of
+     * a result (e.g. the map returned by CardSelectionResult#getSmartCards())
+     * once the result itself has been released.
+     *
+     * <p>The mode applies to all the execution methods, including the const
+     * ones such as executeCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>) const, which can still be invoked
+     * concurrently. The pool of a reader is created by the first execution on
+     * that reader. Each pool is synchronized on its own: taking objects from
+     * it during an execution, and returning them from whichever thread
+     * releases the last reference, never contend with the executions on other
+     * readers. This method is a preparation method and must not be invoked
+     * during executions.
+     *
+     * <p>The pooled result mode is disabled by default.
+     *
+     * @param poolCapacity The maximum number of results kept per reader.
+     * @throw IllegalArgumentException If poolCapacity is 0.
+     * @since 2.1.0
+     */
+    virtual void setPooledResultMode(const std::size_t poolCapacity) = 0;
+
     /**
      * Appends a card selection case to the card selection scenario.
      *
@@ -128,6 +350,11 @@ public:
      * manager via the method importCardSelectionScenario(const std::string&).
      *
      * @return A non-null string.
+     * @throw IllegalStateException If a card selection case carries a
+     * predicate filter (CardSelector#filterByPowerOnData(const
+     * BytesPredicate&) or
+     * CommonIsoCardSelector#filterBySelectApplicationResponse(const
+     * BytesPredicate&)), which cannot be serialized.
      * @see importCardSelectionScenario(const std::string&)
      * @since 1.1.0
      */
@@ -151,6 +378,169 @@ public:
     importCardSelectionScenario(const std::string& cardSelectionScenario)
         = 0;
 
+    /**
+     * Exports the current prepared card selection scenario in binary format.
+     *
+     * <p>The binary format is a compact and versioned alternative to the string
+     * format, intended for the distribution of scenarios to constrained
+     * terminals. Its first byte is the version of the encoding; the rest of
+     * the data can be decoded in place, without intermediate copies.
+     *
+     * <p>The exported data can be imported into the same or another card
+     * selection manager via the method importCardSelectionScenario(const
+     * std::uint8_t*, std::size_t).
+     *
+     * @param cardSelectionScenario The buffer whose content is replaced by the
+     * exported card selection scenario.
+     * @throw IllegalStateException If a card selection case carries a
+     * predicate filter, which cannot be serialized.
+     * @see importCardSelectionScenario(const std::uint8_t*, std::size_t)
+     * @since 2.1.0
+     */
+    virtual void exportCardSelectionScenario(
+        std::vector<std::uint8_t>& cardSelectionScenario) const = 0;
+
+    /**
+     * Imports a card selection scenario provided in binary format.
+     *
+     * <p>The data must have been exported from a card selection manager via
+     * the method exportCardSelectionScenario(std::vector<std::uint8_t>&). It
+     * is read in place and does not need to remain available once the method
+     * has returned.
+     *
+     * @param cardSelectionScenario A pointer to the first byte of the exported
+     * card selection scenario.
+     * @param length The number of bytes of the exported card selection
+     * scenario.
+     * @return The index of the last imported selection in the card selection
+     * scenario.
+     * @throws IllegalArgumentException If the data is null, malformed or
+     * encoded with an unsupported version of the binary format.
+     * @see exportCardSelectionScenario(std::vector<std::uint8_t>&)
+     * @since 2.1.0
+     */
+    virtual int importCardSelectionScenario(
+        const std::uint8_t* cardSelectionScenario, const std::size_t length)
+        = 0;
+
+    /**
+     * Explicitely executes a previously prepared card selection scenario,
+     * notifies each successful selection as soon as it occurs and returns the
+     * card selection result.
+     *
+     * <p>This method behaves as
+     * processCardSelectionScenario(std::shared_ptr<CardReader>) but, in
+     * addition, provides each SmartCard to the selection observer as soon as
+     * its selection case succeeds. In multiple selection mode, the application
+     * can thus start using the first selected applications while the remaining
+     * cases are still being processed.
+     *
+     * @param reader The reader to communicate with the card.
+     * @param selectionObserver The observer to notify of each successful
+     * selection.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the provided reader or observer is
+     * null.
+     * @throw ReaderCommunicationException If the communication with the reader
+     * has failed.
+     * @throw CardCommunicationException If communication with the card has
+     * failed or if the status word check is enabled in the card request and the
+     * card has returned an unexpected code.
+     * @throw InvalidCardResponseException If the card returned invalid data
+     * during the selection process.
+     * @see processCardSelectionScenario(std::shared_ptr<CardReader>)
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<CardSelectionResult>
+    processCardSelectionScenario(
+        std::shared_ptr<CardReader> reader,
+        std::shared_ptr<SmartCardSelectionObserverSpi> selectionObserver)
+        = 0;
+
+    /**
+     * Explicitely executes a previously prepared card selection scenario within
+     * a time budget and returns the possibly partial card selection result.
+     *
+     * <p>This method behaves as
+     * processCardSelectionScenario(std::shared_ptr<CardReader>) but stops the
+     * execution as soon as one of the following events occurs:
+     *
+     * <ul>
+     *   <li>the time budget is exhausted,
+     *   <li>the cancellation is requested through the provided token,
+     *   <li>the card is removed, when the reader is an ObservableCardReader
+     * whose card detection is started; the removal aborts the exchange in
+     * progress without waiting for the APDU timeouts.
+     * </ul>
+     *
+     * <p>The remaining selection cases are then skipped and the returned
+     * result, flagged by CardSelectionResult#isInterrupted(), contains the
+     * cases completed so far.
+     *
+     * @param reader The reader to communicate with the card.
+     * @param timeBudget The maximum duration of the execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the provided reader is null or the
+     * time budget is negative.
+     * @throw ReaderCommunicationException If the communication with the reader
+     * has failed.
+     * @throw CardCommunicationException If communication with the card has
+     * failed or if the status word check is enabled in the card request and the
+     * card has returned an unexpected code.
+     * @throw InvalidCardResponseException If the card returned invalid data
+     * during the selection process.
+     * @see processCardSelectionScenario(std::shared_ptr<CardReader>)
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<CardSelectionResult>
+    processCardSelectionScenario(
+        std::shared_ptr<CardReader> reader,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken)
+        = 0;
+
+    /**
+     * Compiles the current prepared card selection scenario into an immutable
+     * CompiledCardSelectionScenario.
+     *
+     * <p>All the data needed to execute the scenario ("Select Application"
+     * APDUs, power-on data filters, card protocol filters, multiple selection
+     * and channel release options) is computed once by this method. The
+     * returned object is independent of the current manager: subsequent
+     * modifications of the prepared scenario have no effect on it.
+     *
+     * <p>The modes of the manager are handled as follows:
+     *
+     * <ul>
+     *   <li>The DF name prefix grouping, adaptive selection order and
+     * selection statistics modes are captured in the compiled scenario, as
+     * set when this method is invoked, and apply whichever manager executes
+     * it.
+     *   <li>In adaptive selection order mode, the compiled scenario shares the
+     * match counters of the current manager, which are keyed by the selection
+     * indexes of its prepared scenario: every execution of the compiled
+     * scenario, by any manager, updates these counters, and only these, so
+     * that exportSelectionOrderStatistics() of the current manager reflects
+     * them.
+     *   <li>The pooled result mode is a resource policy of the executing
+     * manager: it is read from the manager executing the compiled scenario,
+     * whose per-reader pools are used.
+     * </ul>
+     *
+     * @return A non-null reference.
+     * @throw IllegalStateException If no card selection case has been
+     * prepared.
+     * @see processCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>)
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<CompiledCardSelectionScenario>
+    compileCardSelectionScenario() const = 0;
+
     /**
      * Explicitely executes a previously prepared card selection scenario and
      * returns the card selection result.
@@ -170,6 +560,521 @@ public:
     virtual const std::shared_ptr<CardSelectionResult>
     processCardSelectionScenario(std::shared_ptr<CardReader> reader) = 0;
 
+    /**
+     * Explicitely executes a previously compiled card selection scenario and
+     * returns the card selection result.
+     *
+     * <p>The compiled scenario is executed as is, without any preparation
+     * step, whatever the scenario currently prepared in this manager. The same
+     * compiled scenario can thus be executed on any reader and for any number
+     * of card presentations.
+     *
+     * <p>The processed scenario becomes the one exported by
+     * exportProcessedCardSelectionScenario().
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param reader The reader to communicate with the card.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the provided compiled scenario or
+     * reader is null.
+     * @throw ReaderCommunicationException If the communication with the reader
+     * has failed.
+     * @throw CardCommunicationException If communication with the card has
+     * failed or if the status word check is enabled in the card request and the
+     * card has returned an unexpected code.
+     * @throw InvalidCardResponseException If the card returned invalid data
+     * during the selection process.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<CardSelectionResult>
+    processCardSelectionScenario(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        std::shared_ptr<CardReader> reader)
+        = 0;
+
+    /**
+     * Explicitely executes a previously compiled card selection scenario within
+     * a time budget and returns the possibly partial card selection result.
+     *
+     * <p>This method behaves as processCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>) but stops the execution under the same
+     * conditions as
+     * processCardSelectionScenario(std::shared_ptr<CardReader>, const
+     * std::chrono::milliseconds,
+     * std::shared_ptr<CardSelectionCancellationToken>).
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param reader The reader to communicate with the card.
+     * @param timeBudget The maximum duration of the execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the provided compiled scenario or
+     * reader is null or the time budget is negative.
+     * @throw ReaderCommunicationException If the communication with the reader
+     * has failed.
+     * @throw CardCommunicationException If communication with the card has
+     * failed or if the status word check is enabled in the card request and the
+     * card has returned an unexpected code.
+     * @throw InvalidCardResponseException If the card returned invalid data
+     * during the selection process.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<CardSelectionResult>
+    processCardSelectionScenario(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        std::shared_ptr<CardReader> reader,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken)
+        = 0;
+
+    /**
+     * Executes a previously compiled card selection scenario and returns the
+     * state resulting from this execution.
+     *
+     * <p>Unlike processCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>), this method does not modify the last
+     * processed scenario of the manager: the card selection result and the
+     * exportable processed scenario are held by the returned
+     * ProcessedCardSelectionScenario. The only manager state it updates is the
+     * internal state of the pooled result and adaptive selection order modes,
+     * when set, which the manager synchronizes itself. It can therefore be
+     * invoked concurrently from several threads, without any external
+     * locking, each thread using its own reader.
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param reader The reader to communicate with the card.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the provided compiled scenario or
+     * reader is null.
+     * @throw ReaderCommunicationException If the communication with the reader
+     * has failed.
+     * @throw CardCommunicationException If communication with the card has
+     * failed or if the status word check is enabled in the card request and the
+     * card has returned an unexpected code.
+     * @throw InvalidCardResponseException If the card returned invalid data
+     * during the selection process.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<ProcessedCardSelectionScenario>
+    executeCardSelectionScenario(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        std::shared_ptr<CardReader> reader) const = 0;
+
+    /**
+     * Executes a previously compiled card selection scenario within a time
+     * budget and returns the state resulting from this possibly partial
+     * execution.
+     *
+     * <p>This method behaves as executeCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>) const but stops the execution under the
+     * same conditions as
+     * processCardSelectionScenario(std::shared_ptr<CardReader>, const
+     * std::chrono::milliseconds,
+     * std::shared_ptr<CardSelectionCancellationToken>).
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param reader The reader to communicate with the card.
+     * @param timeBudget The maximum duration of the execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null.
+     * @return A non-null reference.
+     * @throw IllegalArgumentException If the provided compiled scenario or
+     * reader is null or the time budget is negative.
+     * @throw ReaderCommunicationException If the communication with the reader
+     * has failed.
+     * @throw CardCommunicationException If communication with the card has
+     * failed or if the status word check is enabled in the card request and the
+     * card has returned an unexpected code.
+     * @throw InvalidCardResponseException If the card returned invalid data
+     * during the selection process.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<ProcessedCardSelectionScenario>
+    executeCardSelectionScenario(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        std::shared_ptr<CardReader> reader,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken)
+        const = 0;
+
+    /**
+     * Executes a previously compiled card selection scenario simultaneously on
+     * several readers and returns the card selection outcome of each reader.
+     *
+     * <p>The executions are distributed over a bounded pool of at most the
+     * provided number of threads, each execution being carried out as by
+     * executeCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>) const. The method returns when all the
+     * executions are over.
+     *
+     * <p>The failure of the execution on a reader does not interrupt the
+     * executions on the others: the exception that would have been thrown
+     * (ReaderCommunicationException, CardCommunicationException or
+     * InvalidCardResponseException) is reported in the corresponding
+     * CardSelectionOutcome.
+     *
+     * <p>The processed scenario exported by
+     * exportProcessedCardSelectionScenario() is not affected by this method,
+     * which can therefore be invoked concurrently with the other const
+     * methods of a shared manager.
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param readers The readers to communicate with the cards.
+     * @param maxParallelism The maximum number of readers processed at the
+     * same time, 0 to let the implementation use the number of available
+     * hardware threads.
+     * @return A non-null list with one outcome per reader, in the same order as
+     * the provided list.
+     * @throw IllegalArgumentException If the provided compiled scenario, the
+     * list of readers or one of the readers is null.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual const std::vector<std::shared_ptr<CardSelectionOutcome>>
+    processCardSelectionScenario(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        const std::vector<std::shared_ptr<CardReader>>& readers,
+        const std::size_t maxParallelism) const = 0;
+
+    /**
+     * Executes a previously compiled card selection scenario simultaneously on
+     * several readers within a time budget and returns the card selection
+     * outcome of each reader.
+     *
+     * <p>This method behaves as processCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>, const
+     * std::vector<std::shared_ptr<CardReader>>&, const std::size_t) const but
+     * each execution is carried out as by executeCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>, const std::chrono::milliseconds,
+     * std::shared_ptr<CardSelectionCancellationToken>) const. The time budget
+     * applies to each execution, from its start; a cancellation request
+     * interrupts all the executions in progress and the ones not yet started,
+     * whose results are then empty and flagged by
+     * CardSelectionResult#isInterrupted().
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param readers The readers to communicate with the cards.
+     * @param timeBudget The maximum duration of each execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null.
+     * @param maxParallelism The maximum number of readers processed at the
+     * same time, 0 to let the implementation use the number of available
+     * hardware threads.
+     * @return A non-null list with one outcome per reader, in the same order as
+     * the provided list.
+     * @throw IllegalArgumentException If the provided compiled scenario, the
+     * list of readers or one of the readers is null or the time budget is
+     * negative.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual const std::vector<std::shared_ptr<CardSelectionOutcome>>
+    processCardSelectionScenario(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        const std::vector<std::shared_ptr<CardReader>>& readers,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken,
+        const std::size_t maxParallelism) const = 0;
+
+    /**
+     * Executes a previously prepared card selection scenario asynchronously
+     * and provides the card selection result through a future.
+     *
+     * <p>The execution is carried out by the provided task executor and the
+     * calling thread is not blocked. The exceptions that
+     * processCardSelectionScenario(std::shared_ptr<CardReader>) would have
+     * thrown (ReaderCommunicationException, CardCommunicationException or
+     * InvalidCardResponseException) are rethrown by std::future::get().
+     *
+     * <p>Like processCardSelectionScenario(std::shared_ptr<CardReader>), the
+     * execution replaces the last processed scenario of the manager, which is
+     * updated before the future becomes ready. Until then, the prepared card
+     * selection scenario must not be modified, and no other processing method
+     * nor exportProcessedCardSelectionScenario() may be invoked on the manager.
+     * To run several executions at the same time, use
+     * executeCardSelectionScenarioAsync() instead.
+     *
+     * @param reader The reader to communicate with the card.
+     * @param executor The task executor in charge of the execution.
+     * @return A valid future.
+     * @throw IllegalArgumentException If the provided reader or executor is
+     * null.
+     * @see processCardSelectionScenario(std::shared_ptr<CardReader>)
+     * @since 2.1.0
+     */
+    virtual std::future<std::shared_ptr<CardSelectionResult>>
+    processCardSelectionScenarioAsync(
+        std::shared_ptr<CardReader> reader,
+        std::shared_ptr<TaskExecutorSpi> executor)
+        = 0;
+
+    /**
+     * Executes a previously prepared card selection scenario asynchronously
+     * within a time budget and provides the possibly partial card selection
+     * result through a future.
+     *
+     * <p>This method behaves as
+     * processCardSelectionScenarioAsync(std::shared_ptr<CardReader>,
+     * std::shared_ptr<TaskExecutorSpi>) but the execution stops under the same
+     * conditions as
+     * processCardSelectionScenario(std::shared_ptr<CardReader>, const
+     * std::chrono::milliseconds,
+     * std::shared_ptr<CardSelectionCancellationToken>).
+     *
+     * @param reader The reader to communicate with the card.
+     * @param timeBudget The maximum duration of the execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null.
+     * @param executor The task executor in charge of the execution.
+     * @return A valid future.
+     * @throw IllegalArgumentException If the provided reader or executor is
+     * null or the time budget is negative.
+     * @since 2.1.0
+     */
+    virtual std::future<std::shared_ptr<CardSelectionResult>>
+    processCardSelectionScenarioAsync(
+        std::shared_ptr<CardReader> reader,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken,
+        std::shared_ptr<TaskExecutorSpi> executor)
+        = 0;
+
+    /**
+     * Executes a previously prepared card selection scenario asynchronously
+     * and notifies the provided completion handler at the end of the
+     * execution.
+     *
+     * <p>The execution and the notification are carried out by the provided
+     * task executor and the calling thread is not blocked. The exceptions that
+     * processCardSelectionScenario(std::shared_ptr<CardReader>) would have
+     * thrown (ReaderCommunicationException, CardCommunicationException or
+     * InvalidCardResponseException) are reported in the CardSelectionOutcome
+     * provided to the handler.
+     *
+     * <p>Like processCardSelectionScenario(std::shared_ptr<CardReader>), the
+     * execution replaces the last processed scenario of the manager, which is
+     * updated before the completion handler is notified. Until then, the
+     * prepared card selection scenario must not be modified, and no other
+     * processing method nor exportProcessedCardSelectionScenario() may be
+     * invoked on the manager. To run several executions at the same time, use
+     * executeCardSelectionScenarioAsync() instead.
+     *
+     * @param reader The reader to communicate with the card.
+     * @param executor The task executor in charge of the execution.
+     * @param completionHandler The handler to notify at the end of the
+     * execution.
+     * @throw IllegalArgumentException If one of the parameters is null.
+     * @see processCardSelectionScenario(std::shared_ptr<CardReader>)
+     * @since 2.1.0
+     */
+    virtual void processCardSelectionScenarioAsync(
+        std::shared_ptr<CardReader> reader,
+        std::shared_ptr<TaskExecutorSpi> executor,
+        std::shared_ptr<CardSelectionCompletionHandlerSpi> completionHandler)
+        = 0;
+
+    /**
+     * Executes a previously prepared card selection scenario asynchronously
+     * within a time budget and notifies the provided completion handler at
+     * the end of the possibly partial execution.
+     *
+     * <p>This method behaves as
+     * processCardSelectionScenarioAsync(std::shared_ptr<CardReader>,
+     * std::shared_ptr<TaskExecutorSpi>,
+     * std::shared_ptr<CardSelectionCompletionHandlerSpi>) but the execution
+     * stops under the same conditions as
+     * processCardSelectionScenario(std::shared_ptr<CardReader>, const
+     * std::chrono::milliseconds,
+     * std::shared_ptr<CardSelectionCancellationToken>).
+     *
+     * @param reader The reader to communicate with the card.
+     * @param timeBudget The maximum duration of the execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null.
+     * @param executor The task executor in charge of the execution.
+     * @param completionHandler The handler to notify at the end of the
+     * execution.
+     * @throw IllegalArgumentException If the reader, the executor or the
+     * completion handler is null or the time budget is negative.
+     * @since 2.1.0
+     */
+    virtual void processCardSelectionScenarioAsync(
+        std::shared_ptr<CardReader> reader,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken,
+        std::shared_ptr<TaskExecutorSpi> executor,
+        std::shared_ptr<CardSelectionCompletionHandlerSpi> completionHandler)
+        = 0;
+
+    /**
+     * Executes a previously compiled card selection scenario asynchronously
+     * and provides the state resulting from this execution through a future.
+     *
+     * <p>The execution is carried out by the provided task executor as by
+     * executeCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>) const, and the calling thread is not
+     * blocked. The exceptions that the latter would have thrown
+     * (ReaderCommunicationException, CardCommunicationException or
+     * InvalidCardResponseException) are rethrown by std::future::get().
+     *
+     * <p>The last processed scenario of the manager is not affected: several
+     * executions can be in progress at the same time, each one on its own
+     * reader.
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param reader The reader to communicate with the card.
+     * @param executor The task executor in charge of the execution.
+     * @return A valid future.
+     * @throw IllegalArgumentException If one of the parameters is null.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual std::future<std::shared_ptr<ProcessedCardSelectionScenario>>
+    executeCardSelectionScenarioAsync(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        std::shared_ptr<CardReader> reader,
+        std::shared_ptr<TaskExecutorSpi> executor) const = 0;
+
+    /**
+     * Executes a previously compiled card selection scenario asynchronously
+     * within a time budget and provides the state resulting from this possibly
+     * partial execution through a future.
+     *
+     * <p>This method behaves as executeCardSelectionScenarioAsync(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>, std::shared_ptr<TaskExecutorSpi>) const but
+     * the execution stops under the same conditions as
+     * processCardSelectionScenario(std::shared_ptr<CardReader>, const
+     * std::chrono::milliseconds,
+     * std::shared_ptr<CardSelectionCancellationToken>).
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param reader The reader to communicate with the card.
+     * @param timeBudget The maximum duration of the execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null.
+     * @param executor The task executor in charge of the execution.
+     * @return A valid future.
+     * @throw IllegalArgumentException If the compiled scenario, the reader or
+     * the executor is null or the time budget is negative.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual std::future<std::shared_ptr<ProcessedCardSelectionScenario>>
+    executeCardSelectionScenarioAsync(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        std::shared_ptr<CardReader> reader,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken,
+        std::shared_ptr<TaskExecutorSpi> executor) const = 0;
+
+    /**
+     * Executes a previously compiled card selection scenario asynchronously
+     * and notifies the provided completion handler at the end of the
+     * execution.
+     *
+     * <p>The execution and the notification are carried out by the provided
+     * task executor as by executeCardSelectionScenario(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>) const, and the calling thread is not
+     * blocked. The exceptions that the latter would have thrown are reported
+     * to the handler.
+     *
+     * <p>The last processed scenario of the manager is not affected: several
+     * executions can be in progress at the same time, each one on its own
+     * reader.
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param reader The reader to communicate with the card.
+     * @param executor The task executor in charge of the execution.
+     * @param completionHandler The handler to notify at the end of the
+     * execution.
+     * @throw IllegalArgumentException If one of the parameters is null.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual void executeCardSelectionScenarioAsync(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        std::shared_ptr<CardReader> reader,
+        std::shared_ptr<TaskExecutorSpi> executor,
+        std::shared_ptr<ProcessedCardSelectionCompletionHandlerSpi>
+            completionHandler) const = 0;
+
+    /**
+     * Executes a previously compiled card selection scenario asynchronously
+     * within a time budget and notifies the provided completion handler at
+     * the end of the possibly partial execution.
+     *
+     * <p>This method behaves as executeCardSelectionScenarioAsync(const
+     * std::shared_ptr<CompiledCardSelectionScenario>,
+     * std::shared_ptr<CardReader>, std::shared_ptr<TaskExecutorSpi>,
+     * std::shared_ptr<ProcessedCardSelectionCompletionHandlerSpi>) const but
+     * the execution stops under the same conditions as
+     * processCardSelectionScenario(std::shared_ptr<CardReader>, const
+     * std::chrono::milliseconds,
+     * std::shared_ptr<CardSelectionCancellationToken>).
+     *
+     * @param compiledCardSelectionScenario The compiled card selection
+     * scenario to execute.
+     * @param reader The reader to communicate with the card.
+     * @param timeBudget The maximum duration of the execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null.
+     * @param executor The task executor in charge of the execution.
+     * @param completionHandler The handler to notify at the end of the
+     * execution.
+     * @throw IllegalArgumentException If the compiled scenario, the reader,
+     * the executor or the completion handler is null or the time budget is
+     * negative.
+     * @see compileCardSelectionScenario()
+     * @since 2.1.0
+     */
+    virtual void executeCardSelectionScenarioAsync(
+        const std::shared_ptr<CompiledCardSelectionScenario>
+            compiledCardSelectionScenario,
+        std::shared_ptr<CardReader> reader,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken,
+        std::shared_ptr<TaskExecutorSpi> executor,
+        std::shared_ptr<ProcessedCardSelectionCompletionHandlerSpi>
+            completionHandler) const = 0;
+
     /**
      * Schedules the execution of the prepared card selection scenario as soon
      * as a card is presented to the provided ObservableCardReader.
@@ -192,6 +1097,41 @@ public:
         const ObservableCardReader::NotificationMode notificationMode)
         = 0;
 
+    /**
+     * Schedules the execution of the prepared card selection scenario within a
+     * time budget and under the control of a cancellation token as soon as a
+     * card is presented to the provided ObservableCardReader.
+     *
+     * <p>This method behaves as
+     * scheduleCardSelectionScenario(std::shared_ptr<ObservableCardReader>,
+     * const ObservableCardReader::NotificationMode) but each execution of the
+     * scenario stops as soon as the time budget is exhausted, the cancellation
+     * is requested through the provided token or the card is removed. The
+     * remaining selection cases are then skipped and the
+     * CardSelectionResult obtained from the scheduled response is flagged by
+     * CardSelectionResult#isInterrupted().
+     *
+     * @param observableCardReader The reader with which the card communication
+     * is carried out.
+     * @param notificationMode The card notification mode to use when a card is
+     * detected.
+     * @param timeBudget The maximum duration of each execution, zero for no
+     * limit.
+     * @param cancellationToken The token used to request the cancellation, may
+     * be null. Once the cancellation is requested, the execution in progress
+     * is interrupted and the subsequent ones are skipped, the scheduled
+     * response then containing no selection case.
+     * @throw IllegalArgumentException If the reader or the notification mode
+     * is null or the time budget is negative.
+     * @since 2.1.0
+     */
+    virtual void scheduleCardSelectionScenario(
+        std::shared_ptr<ObservableCardReader> observableCardReader,
+        const ObservableCardReader::NotificationMode notificationMode,
+        const std::chrono::milliseconds timeBudget,
+        std::shared_ptr<CardSelectionCancellationToken> cancellationToken)
+        = 0;
+
     /**
      * Analyzes the responses provided by a
      * calypsonet::terminal::reader::CardReaderEvent following the insertion of
@@ -237,6 +1177,10 @@ public:
      * import it and interpret it correctly by a card selection manager that has
      * all the card extensions involved in the selection scenario.
      *
+     * <p>The predicate filters of the scenario, if any, have been evaluated
+     * during its processing: the processed scenario only records their
+     * outcome and can be exported whatever the filters of the scenario.
+     *
      * @return A non-null string.
      * @throw IllegalStateException If the card selection scenario has not yet
      * been processed or has failed.
@@ -261,6 +1205,10 @@ public:
      * card selection scenario.
      * </ul>
      *
+     * <p>The predicate filters of the current scenario, if any, are not
+     * evaluated again: the cards are accepted or rejected as recorded in the
+     * processed scenario.
+     *
      * @param processedCardSelectionScenario The string containing the exported
      * processed card selection scenario.
      * @return A non-null reference.
@@ -275,6 +1223,38 @@ public:
     virtual const std::shared_ptr<CardSelectionResult>
     importProcessedCardSelectionScenario(
         const std::string& processedCardSelectionScenario) const = 0;
+
+    /**
+     * Imports a batch of previously exported processed card selection
+     * scenarios in string format and returns the corresponding card selection
+     * outcomes.
+     *
+     * <p>This method is the bulk equivalent of
+     * importProcessedCardSelectionScenario(const std::string&), with the same
+     * prerequisites for each processed scenario. The processed scenarios are
+     * interpreted concurrently, using at most the provided number of threads.
+     * As with the single import, the predicate filters of the current scenario
+     * are not evaluated again.
+     *
+     * <p>The failure of the import of a processed scenario does not interrupt
+     * the processing of the batch: the exception that
+     * importProcessedCardSelectionScenario(const std::string&) would have
+     * thrown is reported in the corresponding CardSelectionOutcome.
+     *
+     * @param processedCardSelectionScenarios The strings containing the
+     * exported processed card selection scenarios.
+     * @param maxParallelism The maximum number of threads used to interpret the
+     * processed scenarios, 0 to let the implementation use the number of
+     * available hardware threads.
+     * @return A non-null list with one outcome per processed scenario, in the
+     * same order as the provided list.
+     * @see importProcessedCardSelectionScenario(const std::string&)
+     * @since 2.1.0
+     */
+    virtual const std::vector<std::shared_ptr<CardSelectionOutcome>>
+    importProcessedCardSelectionScenarios(
+        const std::vector<std::string>& processedCardSelectionScenarios,
+        const std::size_t maxParallelism) const = 0;
 };
 
 } /* namespace selection */
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <exception>
+#include <memory>
+
+#include "keypop/reader/selection/CardSelectionResult.hpp"
+
+namespace keypop {
+namespace reader {
+namespace selection {
+
+/**
+ * Outcome of a card selection operation which may have failed, provided when
+ * several operations are reported together and the failure of one of them must
+ * not prevent the others from being reported.
+ *
+ * <p>Exactly one of getCardSelectionResult() and getException() is not null.
+ *
+ * @since 2.1.0
+ */
+class CardSelectionOutcome {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~CardSelectionOutcome() = default;
+
+    /**
+     * Indicates whether the operation succeeded.
+     *
+     * @return <b>true</b> if a card selection result is available, <b>false</b>
+     * if the operation has thrown an exception.
+     * @since 2.1.0
+     */
+    virtual bool isSuccessful() const = 0;
+
+    /**
+     * Gets the card selection result of the operation.
+     *
+     * @return Null if the operation has failed.
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<CardSelectionResult>
+    getCardSelectionResult() const = 0;
+
+    /**
+     * Gets the exception thrown by the operation, which is the one that would
+     * have been thrown by the equivalent single operation (e.g.
+     * IllegalArgumentException, InvalidCardResponseException).
+     *
+     * <p>The exception can be rethrown with std::rethrow_exception().
+     *
+     * @return Null if the operation has succeeded.
+     * @since 2.1.0
+     */
+    virtual std::exception_ptr getException() const = 0;
+};
+
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
@@ -12,7 +12,9 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
+#include "keypop/reader/selection/CardSelectionCaseStatistics.hpp"
 #include "keypop/reader/selection/spi/SmartCard.hpp"
 
 namespace keypop {
@@ -46,6 +48,31 @@ public:
     virtual const std::map<int, std::shared_ptr<SmartCard>>&
     getSmartCards() const = 0;
 
+    /**
+     * Gets the SmartCard of all selection cases in a contiguous list indexed
+     * by selection index.
+     *
+     * <p>This is the flat equivalent of getSmartCards(): the entry at a given
+     * index is the SmartCard of the corresponding successful selection case,
+     * or null if the case was not processed or failed. Its size is the number
+     * of selection cases of the scenario.
+     *
+     * @return A not null but possibly empty list.
+     * @see getSuccessfulSelectionMask()
+     * @since 2.1.0
+     */
+    virtual const std::vector<std::shared_ptr<SmartCard>>&
+    getSmartCardList() const = 0;
+
+    /**
+     * Gets a bitmask of the successful selection cases, indexed by selection
+     * index, with the same size as getSmartCardList().
+     *
+     * @return A not null but possibly empty bitmask.
+     * @since 2.1.0
+     */
+    virtual const std::vector<bool>& getSuccessfulSelectionMask() const = 0;
+
     /**
      * Gets the active matching card. I.e. the card that has been selected.
      *
@@ -62,6 +89,36 @@ public:
      * @since 1.0.0
      */
     virtual int getActiveSelectionIndex() const = 0;
+
+    /**
+     * Indicates whether the execution of the card selection scenario was
+     * interrupted before all the selection cases to be processed were
+     * processed, because its time budget was exhausted, its cancellation was
+     * requested or the card was removed.
+     *
+     * <p>When it is the case, the result only contains the selection cases
+     * completed before the interruption.
+     *
+     * @return <b>true</b> if the result is partial.
+     * @since 2.1.0
+     */
+    virtual bool isInterrupted() const = 0;
+
+    /**
+     * Gets the execution statistics of the processed selection cases, ordered
+     * by execution.
+     *
+     * <p>The statistics are only collected when the selection statistics mode
+     * is set with CardSelectionManager#setSelectionStatisticsMode(). The
+     * selection cases that were not executed (e.g. after the first successful
+     * selection in single selection mode) are not reported.
+     *
+     * @return A not null but possibly empty list, always empty when the
+     * selection statistics mode is not set.
+     * @since 2.1.0
+     */
+    virtual const std::vector<std::shared_ptr<CardSelectionCaseStatistics>>&
+    getCardSelectionCaseStatistics() const = 0;
 };
 
 } /* namespace selection */
@@ -10,7 +10,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "keypop/reader/cpp/CardSelectorBase.hpp"
 
@@ -20,6 +24,15 @@ namespace selection {
 
 using keypop::reader::cpp::CardSelectorBase;
 
+/**
+ * Predicate evaluated on raw bytes provided as a pointer to the first byte and
+ * a number of bytes.
+ *
+ * @since 2.1.0
+ */
+typedef std::function<bool(const std::uint8_t* data, std::size_t length)>
+    BytesPredicate;
+
 /**
  * Common filters used to restrict the selection process to certain cards.
  *
@@ -31,6 +44,11 @@ using keypop::reader::cpp::CardSelectorBase;
  * <p>Conversely, if one or more filters have been defined, the card will not be
  * selected if one of them rejects the card.
  *
+ * <p>In particular, the power-on data filters (regular expression, mask,
+ * length range and predicate) are independent of each other: when several of
+ * them are set, the power-on data must be accepted by all of them. Invoking a
+ * filter method again replaces the previous value of that filter only.
+ *
  * @param <T> The type of the lowest level child object.
  * @since 2.0.0
  */
@@ -77,6 +95,71 @@ public:
      * @since 2.0.0
      */
     virtual T& filterByPowerOnData(const std::string& powerOnDataRegex) = 0;
+
+    /**
+     * Restricts the selection process to cards whose power-on data provided by
+     * the reader match a value on the bits selected by a mask.
+     *
+     * <p>The card is selected if its power-on data are at least as long as the
+     * value and if, for each index i of the value, (powerOnData[i] & mask[i])
+     * equals (value[i] & mask[i]). The comparison is made directly on the raw
+     * bytes, without regular expression nor hexadecimal conversion (see
+     * keypop::reader::cpp::PowerOnDataMaskMatcher).
+     *
+     * <p>This filter is combined with the other power-on data filters as
+     * described in the class documentation; a previous mask filter is
+     * replaced.
+     *
+     * @param value The expected power-on data bytes.
+     * @param mask The mask of the significant bits of the value.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the value and the mask are empty,
+     * have different lengths or are longer than 33 bytes.
+     * @since 2.1.0
+     */
+    virtual T& filterByPowerOnDataMask(
+        const std::vector<std::uint8_t>& value,
+        const std::vector<std::uint8_t>& mask)
+        = 0;
+
+    /**
+     * Restricts the selection process to cards whose power-on data length is
+     * within a range.
+     *
+     * <p>This filter is combined with the other power-on data filters as
+     * described in the class documentation; a previous length filter is
+     * replaced.
+     *
+     * @param minLength The minimum length in bytes (inclusive).
+     * @param maxLength The maximum length in bytes (inclusive).
+     * @return The current instance.
+     * @throw IllegalArgumentException If minLength is greater than maxLength.
+     * @since 2.1.0
+     */
+    virtual T& filterByPowerOnDataLength(
+        const std::size_t minLength, const std::size_t maxLength)
+        = 0;
+
+    /**
+     * Restricts the selection process to cards whose power-on data provided by
+     * the reader are accepted by an application defined predicate.
+     *
+     * <p>The predicate is evaluated in-process on the raw power-on data bytes,
+     * without regular expression nor hexadecimal conversion. It is invoked on
+     * the thread processing the selection and must not retain the provided
+     * pointer.
+     *
+     * <p>Being an in-process function, the predicate cannot be serialized: a
+     * card selection scenario containing this filter cannot be exported with
+     * CardSelectionManager#exportCardSelectionScenario(), whereas the
+     * processed scenario resulting from its execution can.
+     *
+     * @param predicate The predicate returning <b>true</b> to accept the card.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the provided predicate is empty.
+     * @since 2.1.0
+     */
+    virtual T& filterByPowerOnData(const BytesPredicate& predicate) = 0;
 };
 
 } /* namespace selection */
@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 
+#include "keypop/reader/selection/Aid.hpp"
 #include "keypop/reader/selection/CardSelector.hpp"
 #include "keypop/reader/selection/FileControlInformation.hpp"
 #include "keypop/reader/selection/FileOccurrence.hpp"
@@ -73,6 +74,45 @@ public:
      */
     virtual T& filterByDfName(const std::string& aid) = 0;
 
+    /**
+     * Selects a card application DF by its name.
+     *
+     * <p>The DF is selected only if its name starts with the provided AID, as
+     * defined by ISO7816-4 chapter 4.2.
+     *
+     * <p>The provided AID will be used as a parameter of the "Selection
+     * Application" ISO card command.
+     *
+     * @param aid The AID, already validated and stored without allocation.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the provided AID is empty.
+     * @since 2.1.0
+     */
+    virtual T& filterByDfName(const Aid& aid) = 0;
+
+    /**
+     * Restricts the selection process to cards whose response to the "Select
+     * Application" command is accepted by an application defined predicate.
+     *
+     * <p>The predicate is evaluated in-process on the raw response bytes
+     * (including the status word), after the other filters. It is invoked on
+     * the thread processing the selection and must not retain the provided
+     * pointer.
+     *
+     * <p>Being an in-process function, the predicate cannot be serialized: a
+     * card selection scenario containing this filter cannot be exported with
+     * CardSelectionManager#exportCardSelectionScenario(), whereas the
+     * processed scenario resulting from its execution can.
+     *
+     * @param predicate The predicate returning <b>true</b> to accept the card.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the provided predicate is empty.
+     * @since 2.1.0
+     */
+    virtual T&
+    filterBySelectApplicationResponse(const BytesPredicate& predicate)
+        = 0;
+
     /**
      * Sets the file occurrence mode (see ISO7816-4).
      *
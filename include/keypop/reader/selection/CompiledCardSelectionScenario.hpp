@@ -0,0 +1,120 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace keypop {
+namespace reader {
+namespace selection {
+
+/**
+ * Immutable image of a card selection scenario, ready to be executed.
+ *
+ * <p>A compiled scenario is produced once by
+ * CardSelectionManager#compileCardSelectionScenario() from the selection cases
+ * prepared with their CardSelectionExtension. The "Select Application" APDUs,
+ * the power-on data filters and the card protocol filters of all the selection
+ * cases are computed at that time, so that the execution of the scenario does
+ * not require any further preparation.
+ *
+ * <p>The content of a compiled scenario never changes. It is therefore not
+ * affected by later modifications of the card selection manager that produced
+ * it and can be executed any number of times, on any reader, via
+ * CardSelectionManager#processCardSelectionScenario(const
+ * std::shared_ptr<CompiledCardSelectionScenario>, std::shared_ptr<CardReader>).
+ * The only state updated by its executions is the adaptive selection order
+ * counters it shares with the manager that compiled it, if that mode was set
+ * (see CardSelectionManager#compileCardSelectionScenario()).
+ *
+ * <p>The power-on data mask and length filters of all the selection cases are
+ * compiled into a single matcher (see
+ * keypop::reader::cpp::PowerOnDataFilterSet), so that one pass over the
+ * power-on data of a card determines the cases that can still match. The
+ * other cases are skipped without any exchange with the card. Since the
+ * power-on data filters of a case must all accept the card, a rejection by
+ * its mask or length filter alone is enough to rule a case out. A case having
+ * a regular expression or predicate power-on data filter may be reported as
+ * able to match by this pass (an implementation may also pre-evaluate the
+ * regular expressions, e.g. combined into a single one), and this filter must
+ * still be evaluated.
+ *
+ * @since 2.1.0
+ */
+class CompiledCardSelectionScenario {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~CompiledCardSelectionScenario() = default;
+
+    /**
+     * Returns the number of card selection cases of the scenario.
+     *
+     * <p>The selection indexes of the cases range from 0 to this value minus
+     * one, in the order in which they were prepared.
+     *
+     * @return A non-negative int.
+     * @since 2.1.0
+     */
+    virtual int getSelectionCaseCount() const = 0;
+
+    /**
+     * Indicates whether the scenario was compiled with the multiple selection
+     * mode set.
+     *
+     * @return <b>true</b> if all the selection cases are processed even in
+     * case of a successful selection.
+     * @see CardSelectionManager#setMultipleSelectionMode()
+     * @since 2.1.0
+     */
+    virtual bool isMultipleSelectionMode() const = 0;
+
+    /**
+     * Indicates whether the scenario was compiled with the release of the
+     * physical channel requested.
+     *
+     * @return <b>true</b> if the physical channel is closed at the end of the
+     * execution of the scenario.
+     * @see CardSelectionManager#prepareReleaseChannel()
+     * @since 2.1.0
+     */
+    virtual bool isReleaseChannelRequested() const = 0;
+
+    /**
+     * Evaluates the power-on data mask and length filters of all the selection
+     * cases in a single pass.
+     *
+     * <p>A cleared flag means that the case cannot match and can be skipped;
+     * the flag of a case is cleared as soon as its mask or length filter
+     * rejects the data, whatever its other filters. A set flag only means that
+     * the case can still match: a case with a regular expression or predicate
+     * power-on data filter may be flagged as able to match, and this filter
+     * must still be evaluated before selecting the case.
+     *
+     * @param powerOnData A pointer to the first byte of the power-on data.
+     * @param length The number of bytes of the power-on data.
+     * @param candidateCases Replaced by one flag per selection case, indexed by
+     * selection index, set for the cases that can still match the provided
+     * data.
+     * @since 2.1.0
+     */
+    virtual void evaluatePowerOnData(
+        const std::uint8_t* powerOnData,
+        const std::size_t length,
+        std::vector<bool>& candidateCases) const = 0;
+};
+
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,250 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "keypop/reader/ReaderApiFactory.hpp"
+#include "keypop/reader/selection/Aid.hpp"
+#include "keypop/reader/selection/CardSelectionManager.hpp"
+#include "keypop/reader/selection/FileControlInformation.hpp"
+#include "keypop/reader/selection/FileOccurrence.hpp"
+#include "keypop/reader/selection/IsoCardSelector.hpp"
+#include "keypop/reader/selection/spi/CardSelectionExtension.hpp"
+
+namespace keypop {
+namespace reader {
+namespace selection {
+
+using keypop::reader::ReaderApiFactory;
+using keypop::reader::selection::spi::CardSelectionExtension;
+
+/**
+ * DF name known at compile time, to be used with IsoCardSelectorDefinition.
+ *
+ * <p>The length of the DF name is checked at compile time: a DF name of less
+ * than 5 or more than 16 bytes does not compile.
+ *
+ * <pre>
+ * typedef DfName<0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09> CalypsoAid;
+ * </pre>
+ *
+ * @param <Bytes> The bytes of the DF name.
+ * @since 2.1.0
+ */
+template <std::uint8_t... Bytes>
+struct DfName {
+    static_assert(
+        sizeof...(Bytes) >= Aid::MIN_LENGTH
+            && sizeof...(Bytes) <= Aid::MAX_LENGTH,
+        "A DF name must contain 5 to 16 bytes");
+
+    enum : std::size_t {
+        /**
+         * Number of bytes of the DF name.
+         *
+         * @since 2.1.0
+         */
+        LENGTH = sizeof...(Bytes)
+    };
+
+    /**
+     * Bytes of the DF name, stored in static read-only data.
+     *
+     * @since 2.1.0
+     */
+    static const std::uint8_t BYTES[sizeof...(Bytes)];
+
+    /**
+     * Returns the DF name as an Aid, without parsing nor heap allocation.
+     *
+     * @return A non-empty Aid.
+     * @since 2.1.0
+     */
+    static Aid
+    toAid()
+    {
+        return Aid(BYTES, LENGTH);
+    }
+};
+
+template <std::uint8_t... Bytes>
+const std::uint8_t DfName<Bytes...>::BYTES[sizeof...(Bytes)] = {Bytes...};
+
+/**
+ * Absence of DF name filter, to be used with IsoCardSelectorDefinition.
+ *
+ * @since 2.1.0
+ */
+struct AnyDfName {};
+
+/**
+ * Absence of card protocol filter, to be used with IsoCardSelectorDefinition.
+ *
+ * <p>A card protocol filter is a type providing the logical protocol name
+ * through a constexpr static function, whose result is checked at compile
+ * time:
+ *
+ * <pre>
+ * struct Iso14443Protocol {
+ *     static constexpr const char* name() { return "ISO_14443_4"; }
+ * };
+ * </pre>
+ *
+ * @since 2.1.0
+ */
+struct AnyCardProtocol {
+    /**
+     * @return Null, meaning that no card protocol filter applies.
+     * @since 2.1.0
+     */
+    static constexpr const char*
+    name()
+    {
+        return nullptr;
+    }
+};
+
+/**
+ * ISO card selector described at compile time.
+ *
+ * <p>The filters of the selector are template arguments, checked by the
+ * compiler (DF name length, occurrence and FCI mode enumerators, non-empty
+ * protocol name), so that an invalid selector is rejected at build time
+ * instead of at run time. The DF name is stored in static read-only data and
+ * passed to IsoCardSelector#filterByDfName(const Aid&) without hexadecimal
+ * parsing.
+ *
+ * <p>The definition is a compile-time checked builder only: applying it still
+ * goes through the regular runtime path, i.e. the selector is created by the
+ * ReaderApiFactory and configured with the virtual filter methods (the
+ * protocol filter building a std::string). The cost of this path is paid once,
+ * when the scenario is prepared; compiling the scenario with
+ * CardSelectionManager#compileCardSelectionScenario() then makes its repeated
+ * execution free of any preparation.
+ *
+ * <pre>
+ * typedef IsoCardSelectorDefinition<
+ *     DfName<0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09>,
+ *     FileOccurrence::FIRST,
+ *     FileControlInformation::FCI,
+ *     Iso14443Protocol> CalypsoSelector;
+ *
+ * CalypsoSelector::prepareSelection(*manager, *factory, calypsoExtension);
+ * auto scenario = manager->compileCardSelectionScenario();
+ * </pre>
+ *
+ * <p>The definition is usable with C++11.
+ *
+ * @param <DfNameT> A DfName, or AnyDfName for no DF name filter.
+ * @param <Occurrence> The file occurrence mode.
+ * @param <Fci> The file control mode.
+ * @param <ProtocolT> A card protocol filter type, or AnyCardProtocol.
+ * @since 2.1.0
+ */
+template <
+    typename DfNameT,
+    FileOccurrence Occurrence = FileOccurrence::FIRST,
+    FileControlInformation Fci = FileControlInformation::FCI,
+    typename ProtocolT = AnyCardProtocol>
+class IsoCardSelectorDefinition final {
+    static_assert(
+        ProtocolT::name() == nullptr || ProtocolT::name()[0] != '\0',
+        "The logical protocol name must not be empty");
+
+public:
+    /**
+     * Applies the filters of the definition to the provided selector.
+     *
+     * @param selector The selector to configure.
+     * @return The provided selector.
+     * @since 2.1.0
+     */
+    static IsoCardSelector&
+    applyTo(IsoCardSelector& selector)
+    {
+        applyDfName(selector, static_cast<const DfNameT*>(nullptr));
+        selector.setFileOccurrence(Occurrence);
+        selector.setFileControlInformation(Fci);
+        if (ProtocolT::name() != nullptr) {
+            selector.filterByCardProtocol(ProtocolT::name());
+        }
+
+        return selector;
+    }
+
+    /**
+     * Creates a new IsoCardSelector configured according to the definition.
+     *
+     * @param factory The factory used to create the selector.
+     * @return A non-null reference.
+     * @since 2.1.0
+     */
+    static std::shared_ptr<IsoCardSelector>
+    createIsoCardSelector(ReaderApiFactory& factory)
+    {
+        const std::shared_ptr<IsoCardSelector> selector
+            = factory.createIsoCardSelector();
+        applyTo(*selector);
+
+        return selector;
+    }
+
+    /**
+     * Appends a card selection case based on the definition to the card
+     * selection scenario of the provided manager.
+     *
+     * @param manager The card selection manager.
+     * @param factory The factory used to create the selector.
+     * @param cardSelectionExtension The card selection extension to be used to
+     * parse the card selection response.
+     * @return The selection index, as returned by
+     * CardSelectionManager#prepareSelection(const
+     * std::shared_ptr<CardSelectorBase>, const
+     * std::shared_ptr<CardSelectionExtension>).
+     * @since 2.1.0
+     */
+    static int
+    prepareSelection(
+        CardSelectionManager& manager,
+        ReaderApiFactory& factory,
+        const std::shared_ptr<CardSelectionExtension> cardSelectionExtension)
+    {
+        return manager.prepareSelection(
+            createIsoCardSelector(factory), cardSelectionExtension);
+    }
+
+private:
+    /**
+     *
+     */
+    template <std::uint8_t... Bytes>
+    static void
+    applyDfName(IsoCardSelector& selector, const DfName<Bytes...>*)
+    {
+        selector.filterByDfName(DfName<Bytes...>::toAid());
+    }
+
+    /**
+     *
+     */
+    static void
+    applyDfName(IsoCardSelector&, const AnyDfName*)
+    {
+    }
+};
+
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
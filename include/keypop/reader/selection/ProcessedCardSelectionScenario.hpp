@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "keypop/reader/selection/CardSelectionResult.hpp"
+
+namespace keypop {
+namespace reader {
+namespace selection {
+
+/**
+ * State resulting from one execution of a card selection scenario.
+ *
+ * <p>Each execution started with
+ * CardSelectionManager#executeCardSelectionScenario(const
+ * std::shared_ptr<CompiledCardSelectionScenario>, std::shared_ptr<CardReader>)
+ * produces its own instance, so that concurrent executions never share any
+ * mutable state.
+ *
+ * @since 2.1.0
+ */
+class ProcessedCardSelectionScenario {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~ProcessedCardSelectionScenario() = default;
+
+    /**
+     * Gets the card selection result of the execution.
+     *
+     * @return A non-null reference.
+     * @since 2.1.0
+     */
+    virtual const std::shared_ptr<CardSelectionResult>
+    getCardSelectionResult() const = 0;
+
+    /**
+     * Exports the content of the processed card selection scenario in string
+     * format.
+     *
+     * <p>The string is identical to the one that
+     * CardSelectionManager#exportProcessedCardSelectionScenario() would have
+     * returned after the same execution, and can be imported via the method
+     * CardSelectionManager#importProcessedCardSelectionScenario(const
+     * std::string&).
+     *
+     * @return A non-null string.
+     * @throw IllegalStateException If the execution of the card selection
+     * scenario has failed.
+     * @since 2.1.0
+     */
+    virtual const std::string exportProcessedCardSelectionScenario() const = 0;
+};
+
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,61 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include "keypop/reader/cpp/ByteView.hpp"
+#include "keypop/reader/selection/spi/ByteViewSmartCard.hpp"
+
+namespace keypop {
+namespace reader {
+namespace selection {
+namespace spi {
+
+using keypop::reader::cpp::ByteView;
+
+/**
+ * Optional interface of an IsoSmartCard giving access to its power-on data and
+ * to its response to the "Select Application" command as raw bytes, without
+ * copy.
+ *
+ * <p>A card extension may implement this interface together with
+ * IsoSmartCard; the application then obtains it with std::dynamic_pointer_cast
+ * and falls back to IsoSmartCard#getSelectApplicationResponse() when the cast
+ * fails. Existing card extensions do not have to implement it.
+ *
+ * <pre>
+ * auto bytes = std::dynamic_pointer_cast<ByteViewIsoSmartCard>(card);
+ * if (bytes) {
+ *     auto fci = BerTlvIndex::fromSelectApplicationResponse(
+ *         bytes->getSelectApplicationResponseBytes());
+ * }
+ * </pre>
+ *
+ * @since 2.1.0
+ */
+class ByteViewIsoSmartCard : public ByteViewSmartCard {
+public:
+    /**
+     * Gets the card data received in response to the "Select Application"
+     * command (including the status word), without copy.
+     *
+     * <p>The returned view refers to bytes owned by the current instance and
+     * remains valid as long as the instance is alive.
+     *
+     * @return An empty view if no selection application has been performed.
+     * @since 2.1.0
+     */
+    virtual ByteView getSelectApplicationResponseBytes() const = 0;
+};
+
+} /* namespace spi */
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include "keypop/reader/cpp/ByteView.hpp"
+
+namespace keypop {
+namespace reader {
+namespace selection {
+namespace spi {
+
+using keypop::reader::cpp::ByteView;
+
+/**
+ * Optional interface of a SmartCard giving access to its power-on data as raw
+ * bytes, without copy nor hexadecimal conversion.
+ *
+ * <p>A card extension may implement this interface together with SmartCard;
+ * the application then obtains it with std::dynamic_pointer_cast and falls
+ * back to SmartCard#getPowerOnData() when the cast fails. Existing card
+ * extensions do not have to implement it.
+ *
+ * @since 2.1.0
+ */
+class ByteViewSmartCard {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~ByteViewSmartCard() = default;
+
+    /**
+     * Gets the raw power-on data collected by the selection process, without
+     * copy nor hexadecimal conversion.
+     *
+     * <p>The returned view refers to bytes owned by the current instance and
+     * remains valid as long as the instance is alive.
+     *
+     * @return An empty view if no power-on data are available.
+     * @since 2.1.0
+     */
+    virtual ByteView getPowerOnDataBytes() const = 0;
+};
+
+} /* namespace spi */
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
@@ -21,6 +21,11 @@ namespace spi {
  * order to build and fill the specific SmartCard which acts as an image of the
  * targeted card.
  *
+ * <p>The methods building the SmartCard are defined by the extension SPI of
+ * the implementation of this API. In pooled result mode, an extension
+ * implementing RecyclingCardSelectionExtension is provided with the pooled
+ * RecyclableSmartCard to fill.
+ *
  * @since 2.0.0
  */
 class CardSelectionExtension {
@@ -0,0 +1,61 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+namespace keypop {
+namespace reader {
+namespace selection {
+namespace spi {
+
+/**
+ * Optional interface of a SmartCard allowing it to be reused from one card
+ * selection to the next when the pooled result mode is set.
+ *
+ * <p>A card extension takes part in the pooling when its SmartCard
+ * implementation also implements this interface and its
+ * CardSelectionExtension also implements RecyclingCardSelectionExtension:
+ * once the application has released all its references to the SmartCard,
+ * recycle() is invoked and the instance is kept in the pool of the reader on
+ * which it was selected, instead of being destroyed, then handed back to the
+ * extension through
+ * RecyclingCardSelectionExtension#provideRecycledSmartCard() for a later
+ * selection on that reader. Other SmartCard implementations are created and
+ * destroyed as usual.
+ *
+ * <p>Must be implemented by a card extension, together with SmartCard.
+ *
+ * @see keypop::reader::selection::CardSelectionManager#setPooledResultMode(
+ * const std::size_t)
+ * @since 2.1.0
+ */
+class RecyclableSmartCard {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~RecyclableSmartCard() = default;
+
+    /**
+     * Invoked when the instance returns to the pool, to clear the data of the
+     * previous card while keeping the allocated memory for the next one.
+     *
+     * <p>The method is invoked from the thread that released the last
+     * reference to the instance and must not throw.
+     *
+     * @since 2.1.0
+     */
+    virtual void recycle() = 0;
+};
+
+} /* namespace spi */
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include "keypop/reader/selection/spi/RecyclableSmartCard.hpp"
+
+namespace keypop {
+namespace reader {
+namespace selection {
+namespace spi {
+
+/**
+ * Optional interface of a CardSelectionExtension through which the card
+ * selection manager hands back a pooled RecyclableSmartCard to fill, in pooled
+ * result mode.
+ *
+ * <p>A card extension may implement this interface together with
+ * CardSelectionExtension; the manager obtains it with std::dynamic_pointer_cast
+ * and, when the cast fails, lets the extension allocate its SmartCard objects
+ * as usual. Existing card extensions do not have to implement it.
+ *
+ * <p>Each pooled instance is only ever handed back to the extension that built
+ * it, and only for a selection made on the reader whose pool holds it.
+ *
+ * @see keypop::reader::selection::CardSelectionManager#setPooledResultMode(
+ * const std::size_t)
+ * @since 2.1.0
+ */
+class RecyclingCardSelectionExtension {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~RecyclingCardSelectionExtension() = default;
+
+    /**
+     * Provides the pooled instance in which the SmartCard of the selection
+     * case in progress must be built.
+     *
+     * <p>The method is invoked when the selection case has succeeded and the
+     * pool of the reader holds an instance built by this extension,
+     * immediately before the extension is asked to build the SmartCard from
+     * the selection response, and on the same thread. The extension must then
+     * fill and return the provided instance instead of allocating a new one;
+     * since the same extension may be used by concurrent executions, it must
+     * keep the instance per thread until that build.
+     *
+     * <p>The instance has been cleared by RecyclableSmartCard#recycle().
+     *
+     * @param smartCard The not null pooled instance to fill.
+     * @since 2.1.0
+     */
+    virtual void
+    provideRecycledSmartCard(std::shared_ptr<RecyclableSmartCard> smartCard)
+        = 0;
+};
+
+} /* namespace spi */
+} /* namespace selection */
+} /* namespace reader */
+} /* namespace keypop */
@@ -32,13 +32,44 @@ public:
      * <p>The event notification should be done <b>sequentially</b> and <b>synchronously</b> but
      * this may depend on the implementation used.
      *
+     * <p>When an event dispatch queue is set on the reader, this method is
+     * invoked by the executor provided to
+     * keypop::reader::ObservableCardReader::setEventDispatchQueue(), not by
+     * the card detection thread.
+     *
      * @param readerEvent The not null CardReaderEvent containing the event
      * data.
+     * @see onReaderEventByReference(const std::shared_ptr<CardReaderEvent>&)
      * @since 1.0.0
      */
     virtual void
     onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent)
         = 0;
+
+    /**
+     * Called when a reader event occurs, with the event passed by reference.
+     *
+     * <p>This is the method actually invoked by the reader. Its default
+     * implementation forwards the event to
+     * onReaderEvent(const std::shared_ptr<CardReaderEvent>), which copies the
+     * std::shared_ptr. Only an observer overriding this method receives the
+     * event without any update of its reference count, its implementation of
+     * onReaderEvent(const std::shared_ptr<CardReaderEvent>) then simply
+     * forwarding to this method.
+     *
+     * <p>The reference is only valid during the call: an observer that needs
+     * the event afterwards must keep a copy of the std::shared_ptr (see
+     * CardReaderEvent about the reuse of events).
+     *
+     * @param readerEvent The not null CardReaderEvent containing the event
+     * data.
+     * @since 2.1.0
+     */
+    virtual void onReaderEventByReference(
+        const std::shared_ptr<CardReaderEvent>& readerEvent)
+    {
+        onReaderEvent(readerEvent);
+    }
 };
 
 } /* namespace spi */
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include "keypop/reader/selection/CardSelectionOutcome.hpp"
+
+namespace keypop {
+namespace reader {
+namespace spi {
+
+using keypop::reader::selection::CardSelectionOutcome;
+
+/**
+ * Completion handler to implement in order to be notified of the end of an
+ * asynchronous card selection scenario execution started with
+ * keypop::reader::selection::CardSelectionManager
+ * ::processCardSelectionScenarioAsync().
+ *
+ * @since 2.1.0
+ */
+class CardSelectionCompletionHandlerSpi {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~CardSelectionCompletionHandlerSpi() = default;
+
+    /**
+     * Called once when the execution of the card selection scenario is over.
+     *
+     * <p>The call is made on a thread of the task executor provided when the
+     * execution was started.
+     *
+     * @param cardSelectionOutcome The not null outcome containing either the
+     * card selection result or the exception that interrupted the execution
+     * (ReaderCommunicationException, CardCommunicationException or
+     * InvalidCardResponseException).
+     * @since 2.1.0
+     */
+    virtual void onCardSelectionCompleted(
+        const std::shared_ptr<CardSelectionOutcome> cardSelectionOutcome)
+        = 0;
+};
+
+} /* namespace spi */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <exception>
+#include <memory>
+
+#include "keypop/reader/selection/ProcessedCardSelectionScenario.hpp"
+
+namespace keypop {
+namespace reader {
+namespace spi {
+
+using keypop::reader::selection::ProcessedCardSelectionScenario;
+
+/**
+ * Completion handler to implement in order to be notified of the end of an
+ * asynchronous execution of a compiled card selection scenario started with
+ * keypop::reader::selection::CardSelectionManager
+ * ::executeCardSelectionScenarioAsync().
+ *
+ * <p>Exactly one of the two methods is called, once, on a thread of the task
+ * executor provided when the execution was started.
+ *
+ * @since 2.1.0
+ */
+class ProcessedCardSelectionCompletionHandlerSpi {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~ProcessedCardSelectionCompletionHandlerSpi() = default;
+
+    /**
+     * Called when the execution of the card selection scenario has succeeded.
+     *
+     * @param processedCardSelectionScenario The not null state resulting from
+     * the execution.
+     * @since 2.1.0
+     */
+    virtual void onCardSelectionScenarioExecuted(
+        const std::shared_ptr<ProcessedCardSelectionScenario>
+            processedCardSelectionScenario)
+        = 0;
+
+    /**
+     * Called when the execution of the card selection scenario has been
+     * interrupted by an exception.
+     *
+     * @param exception The not null exception that
+     * keypop::reader::selection::CardSelectionManager
+     * ::executeCardSelectionScenario() would have thrown
+     * (ReaderCommunicationException, CardCommunicationException or
+     * InvalidCardResponseException), which can be rethrown with
+     * std::rethrow_exception().
+     * @since 2.1.0
+     */
+    virtual void
+    onCardSelectionScenarioFailed(const std::exception_ptr exception) = 0;
+};
+
+} /* namespace spi */
+} /* namespace reader */
+} /* namespace keypop */
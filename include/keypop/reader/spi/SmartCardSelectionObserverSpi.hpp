@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include "keypop/reader/selection/spi/SmartCard.hpp"
+
+namespace keypop {
+namespace reader {
+namespace spi {
+
+using keypop::reader::selection::spi::SmartCard;
+
+/**
+ * Selection observer to implement in order to receive each SmartCard as soon as
+ * its card selection case succeeds, while the rest of the card selection
+ * scenario is still being processed.
+ *
+ * @since 2.1.0
+ */
+class SmartCardSelectionObserverSpi {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~SmartCardSelectionObserverSpi() = default;
+
+    /**
+     * Called when a card selection case succeeds.
+     *
+     * <p>The notification is made <b>sequentially</b> and <b>synchronously</b>
+     * on the thread processing the card selection scenario, in the order of
+     * execution of the cases. The next case is processed only when this method
+     * returns, which must therefore not communicate with the card.
+     *
+     * @param selectionIndex The index of the successful selection case.
+     * @param smartCard The not null SmartCard built by the card extension.
+     * @since 2.1.0
+     */
+    virtual void onSmartCardSelected(
+        const int selectionIndex, const std::shared_ptr<SmartCard> smartCard)
+        = 0;
+};
+
+} /* namespace spi */
+} /* namespace reader */
+} /* namespace keypop */
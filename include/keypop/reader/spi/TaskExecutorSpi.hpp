@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <functional>
+
+namespace keypop {
+namespace reader {
+namespace spi {
+
+/**
+ * Task executor to implement in order to control the threads on which the
+ * asynchronous operations of the reader API are carried out.
+ *
+ * <p>It allows the application to share a small pool of threads between many
+ * readers instead of dedicating a thread to each of them.
+ *
+ * @since 2.1.0
+ */
+class TaskExecutorSpi {
+public:
+    /**
+     * Virtual destructor.
+     */
+    virtual ~TaskExecutorSpi() = default;
+
+    /**
+     * Called to execute a task.
+     *
+     * <p>The task may be executed on any thread, immediately or later, but
+     * must be executed exactly once.
+     *
+     * @param task The not null task to execute.
+     * @since 2.1.0
+     */
+    virtual void execute(std::function<void()> task) = 0;
+};
+
+} /* namespace spi */
+} /* namespace reader */
+} /* namespace keypop */
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+/**
+ * Minimal benchmark helpers shared by the benchmark sources.
+ */
+
+/**
+ * Prevents the compiler from optimizing away a computed value.
+ */
+inline void
+doNotOptimize(const std::size_t value)
+{
+    static volatile std::size_t sink = 0;
+    sink = sink + value;
+}
+
+/**
+ * Runs the provided operation the given number of times and prints the average
+ * duration of one iteration in nanoseconds.
+ *
+ * @param name The name of the measured operation.
+ * @param iterations The number of iterations.
+ * @param operation The operation to measure.
+ * @return The average duration of one iteration in nanoseconds.
+ */
+inline double
+measure(
+    const std::string& name,
+    const std::size_t iterations,
+    const std::function<void()>& operation)
+{
+    /* Warm up */
+    for (std::size_t i = 0; i < iterations / 10 + 1; i++) {
+        operation();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+        operation();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const double nsPerIteration
+        = static_cast<double>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                  .count())
+          / static_cast<double>(iterations);
+
+    std::printf("%-48s %12.1f ns/op\n", name.c_str(), nsPerIteration);
+
+    return nsPerIteration;
+}
+
+/* Benchmarks */
+void berTlvBenchmark();
+void hexBenchmark();
+void observerRegistryBenchmark();
+void powerOnDataFilterBenchmark();
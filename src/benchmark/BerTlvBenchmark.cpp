@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "keypop/reader/cpp/BerTlvIndex.hpp"
+#include "keypop/reader/cpp/ByteView.hpp"
+
+using keypop::reader::cpp::BerTlvIndex;
+using keypop::reader::cpp::ByteView;
+
+namespace {
+
+/* Calypso-like FCI followed by the status word */
+const std::vector<uint8_t> SELECT_RESPONSE
+    = {0x6F, 0x22, 0x84, 0x08, 0x31, 0x54, 0x49, 0x43, 0x2E, 0x49, 0x43, 0x41,
+       0xA5, 0x16, 0xBF, 0x0C, 0x13, 0xC7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x11,
+       0x22, 0x33, 0x44, 0x53, 0x07, 0x06, 0x0A, 0x07, 0x01, 0x20, 0x03, 0x11,
+       0x90, 0x00};
+
+/**
+ * Recursive parser copying each value into a map, as typically written by card
+ * extensions.
+ */
+void
+parseRecursively(
+    const std::vector<uint8_t>& data,
+    std::size_t offset,
+    const std::size_t end,
+    std::map<uint32_t, std::vector<uint8_t>>& values)
+{
+    while (offset < end) {
+        const bool constructed = (data[offset] & 0x20) != 0;
+        uint32_t tag = data[offset];
+        if ((data[offset++] & 0x1F) == 0x1F) {
+            do {
+                tag = (tag << 8) | data[offset];
+            } while ((data[offset++] & 0x80) != 0);
+        }
+
+        std::size_t length = data[offset++];
+        if (length & 0x80) {
+            const std::size_t lengthBytes = length & 0x7F;
+            length = 0;
+            for (std::size_t i = 0; i < lengthBytes; i++) {
+                length = (length << 8) | data[offset++];
+            }
+        }
+
+        if (values.find(tag) == values.end()) {
+            values[tag] = std::vector<uint8_t>(
+                data.begin() + offset, data.begin() + offset + length);
+        }
+        if (constructed) {
+            parseRecursively(data, offset, offset + length, values);
+        }
+        offset += length;
+    }
+}
+
+} /* namespace */
+
+void
+berTlvBenchmark()
+{
+    const std::size_t iterations = 100000;
+    std::size_t total = 0;
+
+    /* DF name, application serial number and discretionary data */
+    measure("BER-TLV 3 lookups - naive recursive parsing", iterations, [&]() {
+        std::map<uint32_t, std::vector<uint8_t>> values;
+        parseRecursively(
+            SELECT_RESPONSE, 0, SELECT_RESPONSE.size() - 2, values);
+        total += values[0x84].size() + values[0xC7].size()
+                 + values[0x53].size();
+    });
+    doNotOptimize(total);
+
+    measure("BER-TLV 3 lookups - BerTlvIndex", iterations, [&]() {
+        const BerTlvIndex index = BerTlvIndex::fromSelectApplicationResponse(
+            ByteView(SELECT_RESPONSE));
+        total += index.find(0x84).size() + index.find(0xC7).size()
+                 + index.find(0x53).size();
+    });
+    doNotOptimize(total);
+}
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "keypop/reader/cpp/HexUtil.hpp"
+
+using keypop::reader::cpp::HexUtil;
+
+namespace {
+
+/**
+ * Scalar codec using lookup tables, one byte at a time, as the baseline of the
+ * vectorized HexUtil codec.
+ */
+std::string
+scalarToHex(const std::vector<uint8_t>& bytes)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    std::string hex;
+    for (const uint8_t b : bytes) {
+        hex += digits[b >> 4];
+        hex += digits[b & 0x0F];
+    }
+
+    return hex;
+}
+
+bool
+scalarFromHex(const std::string& hex, std::vector<uint8_t>& bytes)
+{
+    struct Table {
+        int8_t values[256];
+
+        Table()
+        {
+            for (int c = 0; c < 256; c++) {
+                values[c] = -1;
+            }
+            for (int i = 0; i < 10; i++) {
+                values['0' + i] = static_cast<int8_t>(i);
+            }
+            for (int i = 0; i < 6; i++) {
+                values['A' + i] = static_cast<int8_t>(10 + i);
+                values['a' + i] = static_cast<int8_t>(10 + i);
+            }
+        }
+    };
+    static const Table table;
+
+    if (hex.size() % 2 != 0) {
+        return false;
+    }
+    bytes.resize(hex.size() / 2);
+    for (std::size_t i = 0; i < bytes.size(); i++) {
+        const int high = table.values[static_cast<uint8_t>(hex[2 * i])];
+        const int low = table.values[static_cast<uint8_t>(hex[2 * i + 1])];
+        if ((high | low) < 0) {
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+
+    return true;
+}
+
+} /* namespace */
+
+void
+hexBenchmark()
+{
+    const std::size_t iterations = 100000;
+
+    /* Sizes of an AID, an ATR and a typical exported scenario fragment */
+    const std::vector<std::size_t> sizes = {16, 33, 512};
+
+    for (const std::size_t size : sizes) {
+        std::vector<uint8_t> bytes(size);
+        for (std::size_t i = 0; i < size; i++) {
+            bytes[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+        const std::string hex = HexUtil::toHex(bytes);
+        const std::string suffix = " (" + std::to_string(size) + " bytes)";
+        std::size_t total = 0;
+
+        measure("Hex encode - scalar" + suffix, iterations, [&]() {
+            total += scalarToHex(bytes).size();
+        });
+        measure("Hex encode - HexUtil" + suffix, iterations, [&]() {
+            total += HexUtil::toHex(bytes).size();
+        });
+
+        std::vector<uint8_t> decoded;
+        measure("Hex decode - scalar" + suffix, iterations, [&]() {
+            total += scalarFromHex(hex, decoded) ? decoded.size() : 0;
+        });
+        measure("Hex decode - HexUtil" + suffix, iterations, [&]() {
+            total += HexUtil::fromHex(hex, decoded) ? decoded.size() : 0;
+        });
+
+        doNotOptimize(total);
+    }
+}
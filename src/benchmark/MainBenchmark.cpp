@@ -0,0 +1,22 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include "Benchmark.hpp"
+
+int
+main()
+{
+    berTlvBenchmark();
+    hexBenchmark();
+    observerRegistryBenchmark();
+    powerOnDataFilterBenchmark();
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "keypop/reader/cpp/CopyOnWriteObserverRegistry.hpp"
+
+using keypop::reader::cpp::CopyOnWriteObserverRegistry;
+
+namespace {
+
+struct Observer {
+    std::size_t hits;
+};
+
+const std::size_t OBSERVER_COUNT = 8;
+const std::size_t DISPATCH_THREAD_COUNT = 4;
+const std::size_t DISPATCHES_PER_THREAD = 200000;
+
+/**
+ * Observer list guarded by a mutex held during the whole delivery.
+ */
+class LockedRegistry {
+public:
+    void
+    add(const std::shared_ptr<Observer>& observer)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mObservers.push_back(observer);
+    }
+
+    void
+    remove(const std::shared_ptr<Observer>& observer)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto it = mObservers.begin(); it != mObservers.end(); ++it) {
+            if (*it == observer) {
+                mObservers.erase(it);
+                break;
+            }
+        }
+    }
+
+    template <typename Function>
+    void
+    forEach(Function function)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (const std::shared_ptr<Observer>& observer : mObservers) {
+            function(observer);
+        }
+    }
+
+private:
+    std::mutex mMutex;
+    std::vector<std::shared_ptr<Observer>> mObservers;
+};
+
+/**
+ * Dispatches events from several threads while another thread keeps
+ * subscribing and unsubscribing an observer, and prints the average duration
+ * of one dispatch.
+ */
+template <typename Registry>
+void
+measureContention(const std::string& name, Registry& registry)
+{
+    for (std::size_t i = 0; i < OBSERVER_COUNT; i++) {
+        registry.add(std::make_shared<Observer>(Observer{0}));
+    }
+
+    std::atomic<bool> stop(false);
+    std::thread mutator([&registry, &stop]() {
+        const std::shared_ptr<Observer> transient
+            = std::make_shared<Observer>(Observer{0});
+        while (!stop.load(std::memory_order_relaxed)) {
+            registry.add(transient);
+            registry.remove(transient);
+            std::this_thread::yield();
+        }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+
+    /* Per-thread totals, only consumed after the join */
+    std::vector<std::size_t> delivered(DISPATCH_THREAD_COUNT, 0);
+    std::vector<std::thread> dispatchers;
+    for (std::size_t t = 0; t < DISPATCH_THREAD_COUNT; t++) {
+        std::size_t& total = delivered[t];
+        dispatchers.push_back(std::thread([&registry, &total]() {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < DISPATCHES_PER_THREAD; i++) {
+                registry.forEach(
+                    [&count](const std::shared_ptr<Observer>& observer) {
+                        count += observer->hits + 1;
+                    });
+            }
+            total = count;
+        }));
+    }
+    for (std::thread& dispatcher : dispatchers) {
+        dispatcher.join();
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::size_t sum = 0;
+    for (const std::size_t total : delivered) {
+        sum += total;
+    }
+    doNotOptimize(sum);
+
+    stop.store(true);
+    mutator.join();
+
+    std::printf(
+        "%-48s %12.1f ns/op\n",
+        name.c_str(),
+        static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count())
+            / static_cast<double>(DISPATCHES_PER_THREAD));
+}
+
+} /* namespace */
+
+void
+observerRegistryBenchmark()
+{
+    LockedRegistry lockedRegistry;
+    measureContention("observers: mutex-guarded list dispatch", lockedRegistry);
+
+    CopyOnWriteObserverRegistry<Observer> copyOnWriteRegistry;
+    measureContention(
+        "observers: copy-on-write registry dispatch", copyOnWriteRegistry);
+}
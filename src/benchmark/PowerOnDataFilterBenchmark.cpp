@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "keypop/reader/cpp/HexUtil.hpp"
+#include "keypop/reader/cpp/PowerOnDataFilterSet.hpp"
+#include "keypop/reader/cpp/PowerOnDataMaskMatcher.hpp"
+
+using keypop::reader::cpp::HexUtil;
+using keypop::reader::cpp::PowerOnDataFilterSet;
+using keypop::reader::cpp::PowerOnDataMaskMatcher;
+
+namespace {
+
+/**
+ * A realistic set of contact and contactless ATRs, as hexadecimal strings (as
+ * provided by SmartCard::getPowerOnData()) and as raw bytes.
+ */
+const std::vector<std::string> ATR_HEX = {
+    "3B8880010000000000718100F9",
+    "3B8F8001804F0CA000000306030001000000006A",
+    "3B8E800180318066409089120802830190000B",
+    "3B8C800150A3B9A3C20000000000000098",
+    "3B6F00008031E06B0420050259555555555555",
+    "3BDE18FFC080B1FE451F034573744944203132382D6665644C",
+};
+
+std::vector<uint8_t>
+fromHex(const std::string& hex)
+{
+    std::vector<uint8_t> bytes;
+    HexUtil::fromHex(hex, bytes);
+
+    return bytes;
+}
+
+} /* namespace */
+
+void
+powerOnDataFilterBenchmark()
+{
+    const std::size_t iterations = 100000;
+
+    std::vector<std::vector<uint8_t>> atrBytes;
+    for (const auto& atr : ATR_HEX) {
+        atrBytes.push_back(fromHex(atr));
+    }
+
+    /* Calypso-like filter: "3B8880010X00000000718100F9" with X any nibble */
+    const std::regex regex("3B8880010.00000000718100F9");
+    std::vector<uint8_t> mask(13, 0xFF);
+    mask[4] = 0xF0;
+    const PowerOnDataMaskMatcher matcher(fromHex("3B8880010000000000718100F9"),
+                                         mask);
+
+    std::size_t matchCount = 0;
+
+    measure("Power-on data filter - std::regex_match", iterations, [&]() {
+        for (const auto& atr : ATR_HEX) {
+            matchCount += std::regex_match(atr, regex) ? 1 : 0;
+        }
+    });
+    doNotOptimize(matchCount);
+
+    measure("Power-on data filter - PowerOnDataMaskMatcher", iterations, [&]() {
+        for (const auto& atr : atrBytes) {
+            matchCount += matcher.matches(atr) ? 1 : 0;
+        }
+    });
+    doNotOptimize(matchCount);
+
+    /* Scenario of 24 cases: 8 distinct values for each of 3 distinct masks */
+    std::vector<PowerOnDataMaskMatcher> matchers;
+    PowerOnDataFilterSet filterSet;
+    const std::vector<std::vector<uint8_t>> masks = {
+        {0xFF, 0xFF, 0xFF, 0xFF},
+        {0xFF, 0xF0, 0xFF, 0xFF, 0xFF},
+        {0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF}};
+    for (const auto& m : masks) {
+        for (uint8_t v = 0; v < 8; v++) {
+            std::vector<uint8_t> value(m.size(), 0x00);
+            value[0] = 0x3B;
+            value[1] = static_cast<uint8_t>(0x80 + v);
+            matchers.push_back(PowerOnDataMaskMatcher(value, m));
+            filterSet.addCase(matchers.back());
+        }
+    }
+
+    measure("24 power-on data filters - one by one", iterations, [&]() {
+        for (const auto& atr : atrBytes) {
+            for (const auto& m : matchers) {
+                matchCount += m.matches(atr) ? 1 : 0;
+            }
+        }
+    });
+    doNotOptimize(matchCount);
+
+    std::vector<bool> candidates;
+    measure("24 power-on data filters - filter set", iterations, [&]() {
+        for (const auto& atr : atrBytes) {
+            filterSet.match(atr.data(), atr.size(), candidates);
+            matchCount += candidates[0] ? 1 : 0;
+        }
+    });
+    doNotOptimize(matchCount);
+}
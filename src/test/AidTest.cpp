@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/selection/Aid.hpp"
+
+using keypop::reader::selection::Aid;
+
+TEST(AidTest, createsFromBytesAndHex)
+{
+    const std::vector<uint8_t> bytes = {0xA0, 0x00, 0x00, 0x04, 0x04, 0x01};
+    const Aid fromBytes(bytes);
+    const Aid fromHex(std::string("A00000040401"));
+    const Aid fromLowerHex(std::string("a00000040401"));
+
+    ASSERT_EQ(fromBytes.size(), 6u);
+    ASSERT_EQ(fromBytes.toVector(), bytes);
+    ASSERT_EQ(fromBytes, fromHex);
+    ASSERT_EQ(fromBytes, fromLowerHex);
+    ASSERT_TRUE(Aid().empty());
+}
+
+TEST(AidTest, rejectsInvalidInput)
+{
+    ASSERT_THROW(Aid(std::vector<uint8_t>(4, 0xA0)), std::invalid_argument);
+    ASSERT_THROW(Aid(std::vector<uint8_t>(17, 0xA0)), std::invalid_argument);
+    ASSERT_THROW(Aid(std::string("A00000040")), std::invalid_argument);
+    ASSERT_THROW(Aid(std::string("A0000004G4")), std::invalid_argument);
+}
+
+TEST(AidTest, startsWith)
+{
+    const Aid aid(std::string("A0000004040125090101"));
+
+    ASSERT_TRUE(aid.startsWith(Aid(std::string("A000000404"))));
+    ASSERT_TRUE(aid.startsWith(aid));
+    ASSERT_FALSE(aid.startsWith(Aid(std::string("A000000405"))));
+    ASSERT_FALSE(aid.startsWith(Aid(std::string("A000000404012509010101"))));
+    ASSERT_TRUE(aid.startsWith(Aid()));
+
+    const Aid full(std::string("A0000004040125090101020304050607"));
+    ASSERT_TRUE(full.startsWith(aid));
+    ASSERT_FALSE(
+        full.startsWith(Aid(std::string("A0000004040125090101020304050608"))));
+}
+
+TEST(AidTest, compareAndHash)
+{
+    const Aid a(std::string("A000000404"));
+    const Aid b(std::string("A00000040401"));
+    const Aid c(std::string("A000000405"));
+
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(b < c);
+    ASSERT_FALSE(c < a);
+    ASSERT_NE(a, b);
+
+    std::unordered_set<Aid> set = {a, b, c, Aid(std::string("A000000404"))};
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.count(Aid(std::string("a00000040401"))), 1u);
+}
+
+TEST(AidTest, printsHex)
+{
+    std::ostringstream os;
+    os << Aid(std::string("a000000404"));
+
+    ASSERT_EQ(os.str(), "AID: A000000404");
+}
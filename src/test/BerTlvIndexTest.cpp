@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/cpp/BerTlvIndex.hpp"
+#include "keypop/reader/cpp/ByteView.hpp"
+
+using keypop::reader::cpp::BerTlvIndex;
+using keypop::reader::cpp::ByteView;
+
+/* Calypso-like FCI followed by the status word */
+static const std::vector<uint8_t> SELECT_RESPONSE
+    = {0x6F, 0x22, 0x84, 0x08, 0x31, 0x54, 0x49, 0x43, 0x2E, 0x49, 0x43, 0x41,
+       0xA5, 0x16, 0xBF, 0x0C, 0x13, 0xC7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x11,
+       0x22, 0x33, 0x44, 0x53, 0x07, 0x06, 0x0A, 0x07, 0x01, 0x20, 0x03, 0x11,
+       0x90, 0x00};
+
+TEST(BerTlvIndexTest, indexesNestedDataObjects)
+{
+    const BerTlvIndex index = BerTlvIndex::fromSelectApplicationResponse(
+        ByteView(SELECT_RESPONSE));
+
+    ASSERT_TRUE(index.isValid());
+    ASSERT_FALSE(index.isTruncated());
+    ASSERT_EQ(index.size(), 6u);
+
+    ASSERT_EQ(index[0].tag, 0x6Fu);
+    ASSERT_EQ(index[0].depth, 0);
+    ASSERT_EQ(index[3].tag, 0xBF0Cu);
+    ASSERT_EQ(index[3].depth, 2);
+    ASSERT_EQ(index[4].tag, 0xC7u);
+    ASSERT_EQ(index[4].depth, 3);
+
+    ASSERT_EQ(
+        index.find(0x84).toVector(),
+        std::vector<uint8_t>(
+            {0x31, 0x54, 0x49, 0x43, 0x2E, 0x49, 0x43, 0x41}));
+    ASSERT_EQ(
+        index.find(0xC7).toVector(),
+        std::vector<uint8_t>(
+            {0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x33, 0x44}));
+    ASSERT_EQ(index.find(0x53).size(), 7u);
+    ASSERT_EQ(index.find(0xA5).data(), SELECT_RESPONSE.data() + 14);
+    ASSERT_FALSE(index.contains(0x90));
+    ASSERT_TRUE(index.find(0x50).empty());
+}
+
+TEST(BerTlvIndexTest, findsFirstOccurrenceAndEmptyValues)
+{
+    const std::vector<uint8_t> data
+        = {0x50, 0x01, 0xAA, 0x87, 0x00, 0x50, 0x01, 0xBB};
+    const BerTlvIndex index((ByteView(data)));
+
+    ASSERT_TRUE(index.isValid());
+    ASSERT_EQ(index.size(), 3u);
+    ASSERT_EQ(index.find(0x50)[0], 0xAA);
+    ASSERT_TRUE(index.contains(0x87));
+    ASSERT_TRUE(index.find(0x87).empty());
+}
+
+TEST(BerTlvIndexTest, decodesLongFormLength)
+{
+    std::vector<uint8_t> data = {0x62, 0x81, 0x83, 0x83, 0x81, 0x80};
+    data.resize(data.size() + 0x80, 0x5A);
+    const BerTlvIndex index((ByteView(data)));
+
+    ASSERT_TRUE(index.isValid());
+    ASSERT_EQ(index.find(0x62).size(), 0x83u);
+    ASSERT_EQ(index.find(0x83).size(), 0x80u);
+}
+
+TEST(BerTlvIndexTest, keepsEntriesBeforeMalformedData)
+{
+    const std::vector<uint8_t> data = {0x84, 0x01, 0xAA, 0xA5, 0x05, 0x50};
+    const BerTlvIndex index((ByteView(data)));
+
+    ASSERT_FALSE(index.isValid());
+    ASSERT_TRUE(index.contains(0x84));
+    ASSERT_FALSE(index.contains(0xA5));
+
+    const std::vector<uint8_t> unfinishedTag = {0x9F};
+    ASSERT_FALSE(BerTlvIndex(ByteView(unfinishedTag)).isValid());
+
+    const BerTlvIndex empty((ByteView()));
+    ASSERT_TRUE(empty.isValid());
+    ASSERT_EQ(empty.size(), 0u);
+}
+
+TEST(BerTlvIndexTest, reportsTruncation)
+{
+    std::vector<uint8_t> data;
+    for (std::size_t i = 0; i < BerTlvIndex::MAX_ENTRIES + 2; i++) {
+        data.push_back(static_cast<uint8_t>(0x80 + (i % 16)));
+        data.push_back(0x00);
+    }
+    const BerTlvIndex index((ByteView(data)));
+
+    ASSERT_TRUE(index.isValid());
+    ASSERT_TRUE(index.isTruncated());
+    ASSERT_EQ(index.size(), BerTlvIndex::MAX_ENTRIES);
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/cpp/BoundedEventQueue.hpp"
+
+using keypop::reader::cpp::BoundedEventQueue;
+
+TEST(BoundedEventQueueTest, capacityIsExact)
+{
+    BoundedEventQueue<int> queue(3);
+    int element = 0;
+
+    ASSERT_EQ(queue.capacity(), 3u);
+    for (int i = 0; i < 3; i++) {
+        element = i;
+        ASSERT_TRUE(queue.tryPush(element));
+    }
+    ASSERT_FALSE(queue.tryPush(element));
+    ASSERT_THROW(BoundedEventQueue<int>(0), std::invalid_argument);
+}
+
+TEST(BoundedEventQueueTest, capacityOfOne)
+{
+    BoundedEventQueue<int> queue(1);
+
+    for (int i = 0; i < 3; i++) {
+        int element = i;
+        ASSERT_TRUE(queue.tryPush(element));
+        ASSERT_FALSE(queue.tryPush(element));
+        ASSERT_TRUE(queue.tryPop(element));
+        ASSERT_EQ(element, i);
+        ASSERT_FALSE(queue.tryPop(element));
+    }
+}
+
+TEST(BoundedEventQueueTest, deliversInOrderAndRejectsWhenFull)
+{
+    BoundedEventQueue<std::shared_ptr<int>> queue(4);
+    std::shared_ptr<int> element;
+
+    ASSERT_FALSE(queue.tryPop(element));
+
+    for (int i = 0; i < 4; i++) {
+        element = std::make_shared<int>(i);
+        ASSERT_TRUE(queue.tryPush(element));
+        ASSERT_EQ(element, nullptr);
+    }
+
+    element = std::make_shared<int>(4);
+    ASSERT_FALSE(queue.tryPush(element));
+    ASSERT_EQ(*element, 4);
+
+    /* Drop oldest */
+    std::shared_ptr<int> dropped;
+    ASSERT_TRUE(queue.tryPop(dropped));
+    ASSERT_EQ(*dropped, 0);
+    ASSERT_TRUE(queue.tryPush(element));
+
+    for (int i = 1; i <= 4; i++) {
+        ASSERT_TRUE(queue.tryPop(element));
+        ASSERT_EQ(*element, i);
+    }
+    ASSERT_FALSE(queue.tryPop(element));
+}
+
+TEST(BoundedEventQueueTest, preservesOrderAcrossThreads)
+{
+    const int count = 100000;
+    BoundedEventQueue<int> queue(10);
+
+    std::thread producer([&queue, count]() {
+        for (int i = 0; i < count; i++) {
+            int value = i;
+            while (!queue.tryPush(value)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    while (expected < count) {
+        int value;
+        if (queue.tryPop(value)) {
+            ASSERT_EQ(value, expected);
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+}
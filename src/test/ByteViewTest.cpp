@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/cpp/ByteView.hpp"
+
+using keypop::reader::cpp::ByteView;
+
+TEST(ByteViewTest, defaultViewIsEmpty)
+{
+    const ByteView view;
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(view.size(), 0u);
+    ASSERT_EQ(view.begin(), view.end());
+    ASSERT_TRUE(view.toVector().empty());
+}
+
+TEST(ByteViewTest, viewsBytesWithoutCopy)
+{
+    const std::vector<uint8_t> bytes = {0x6F, 0x10, 0x84, 0x08, 0x90, 0x00};
+    const ByteView view(bytes);
+
+    ASSERT_EQ(view.data(), bytes.data());
+    ASSERT_EQ(view.size(), bytes.size());
+    ASSERT_EQ(view[2], 0x84);
+    ASSERT_EQ(
+        std::accumulate(view.begin(), view.end(), 0),
+        0x6F + 0x10 + 0x84 + 0x08 + 0x90);
+    ASSERT_EQ(view.toVector(), bytes);
+    ASSERT_EQ(
+        ByteView(bytes.data() + 4, 2).toVector(),
+        std::vector<uint8_t>({0x90, 0x00}));
+}
@@ -0,0 +1,143 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/CardReaderEvent.hpp"
+#include "keypop/reader/cpp/CopyOnWriteObserverRegistry.hpp"
+
+using keypop::reader::CardReaderEvent;
+using keypop::reader::cpp::CopyOnWriteObserverRegistry;
+
+namespace {
+
+struct Observer {
+    int id;
+};
+
+} /* namespace */
+
+TEST(CopyOnWriteObserverRegistryTest, addRemoveClear)
+{
+    CopyOnWriteObserverRegistry<Observer> registry;
+    const std::shared_ptr<Observer> a = std::make_shared<Observer>(Observer{1});
+    const std::shared_ptr<Observer> b = std::make_shared<Observer>(Observer{2});
+
+    ASSERT_EQ(registry.size(), 0);
+    ASSERT_TRUE(registry.add(a));
+    ASSERT_FALSE(registry.add(a));
+    ASSERT_TRUE(registry.add(b));
+    ASSERT_EQ(registry.size(), 2);
+
+    std::vector<int> ids;
+    registry.forEach([&ids](const std::shared_ptr<Observer>& observer) {
+        ids.push_back(observer->id);
+    });
+    ASSERT_EQ(ids, std::vector<int>({1, 2}));
+
+    ASSERT_TRUE(registry.remove(a));
+    ASSERT_FALSE(registry.remove(a));
+    ASSERT_EQ(registry.size(), 1);
+
+    registry.clear();
+    ASSERT_EQ(registry.size(), 0);
+}
+
+TEST(CopyOnWriteObserverRegistryTest, snapshotIsNotAffectedByMutations)
+{
+    CopyOnWriteObserverRegistry<Observer> registry;
+    const std::shared_ptr<Observer> a = std::make_shared<Observer>(Observer{1});
+    registry.add(a);
+
+    const auto snapshot = registry.snapshot();
+    registry.remove(a);
+    registry.add(std::make_shared<Observer>(Observer{2}));
+
+    ASSERT_EQ(snapshot->registrations.size(), 1u);
+    ASSERT_EQ(snapshot->registrations[0].observer, a);
+    ASSERT_EQ(registry.snapshot()->registrations[0].observer->id, 2);
+}
+
+TEST(CopyOnWriteObserverRegistryTest, deliversOnlySubscribedEventTypes)
+{
+    const CardReaderEvent::TypeMask inserted
+        = CardReaderEvent::typeMask(CardReaderEvent::CARD_INSERTED);
+    const CardReaderEvent::TypeMask matched
+        = CardReaderEvent::typeMask(CardReaderEvent::CARD_MATCHED);
+    const CardReaderEvent::TypeMask removed
+        = CardReaderEvent::typeMask(CardReaderEvent::CARD_REMOVED);
+    const CardReaderEvent::TypeMask unavailable
+        = CardReaderEvent::typeMask(CardReaderEvent::UNAVAILABLE);
+    ASSERT_EQ(
+        inserted | matched | removed | unavailable,
+        CardReaderEvent::allTypesMask());
+
+    CopyOnWriteObserverRegistry<Observer> registry;
+    const std::shared_ptr<Observer> a = std::make_shared<Observer>(Observer{1});
+    const std::shared_ptr<Observer> b = std::make_shared<Observer>(Observer{2});
+    registry.add(a, inserted);
+    registry.add(b, matched | removed);
+
+    ASSERT_TRUE(registry.isObserved(removed));
+    ASSERT_FALSE(registry.isObserved(unavailable));
+
+    std::vector<int> ids;
+    const auto collect = [&ids](const std::shared_ptr<Observer>& observer) {
+        ids.push_back(observer->id);
+    };
+    registry.forEach(matched, collect);
+    ASSERT_EQ(ids, std::vector<int>({2}));
+
+    /* Updating the mask of a registered observer */
+    ASSERT_FALSE(registry.add(a, unavailable));
+    ASSERT_EQ(registry.size(), 2);
+    ASSERT_FALSE(registry.isObserved(inserted));
+    ids.clear();
+    registry.forEach(unavailable, collect);
+    ASSERT_EQ(ids, std::vector<int>({1}));
+
+    registry.remove(a);
+    ASSERT_FALSE(registry.isObserved(unavailable));
+}
+
+TEST(CopyOnWriteObserverRegistryTest, deliveryDuringConcurrentMutations)
+{
+    CopyOnWriteObserverRegistry<Observer> registry;
+    const std::shared_ptr<Observer> stable
+        = std::make_shared<Observer>(Observer{0});
+    registry.add(stable);
+
+    std::atomic<bool> stop(false);
+    std::thread mutator([&registry, &stop]() {
+        const std::shared_ptr<Observer> transient
+            = std::make_shared<Observer>(Observer{1});
+        while (!stop.load()) {
+            registry.add(transient);
+            registry.remove(transient);
+        }
+    });
+
+    for (int i = 0; i < 100000; i++) {
+        int stableCount = 0;
+        registry.forEach([&stableCount](const std::shared_ptr<Observer>& o) {
+            stableCount += o->id == 0 ? 1 : 0;
+        });
+        ASSERT_EQ(stableCount, 1);
+    }
+
+    stop.store(true);
+    mutator.join();
+}
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/cpp/HexUtil.hpp"
+
+using keypop::reader::cpp::HexUtil;
+
+static std::string
+referenceHex(const std::vector<uint8_t>& bytes)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    std::string hex;
+    for (const uint8_t b : bytes) {
+        hex += digits[b >> 4];
+        hex += digits[b & 0x0F];
+    }
+
+    return hex;
+}
+
+TEST(HexUtilTest, encodesAllLengthsAndValues)
+{
+    /* Covers the vectorized blocks and the scalar tail */
+    for (std::size_t length = 0; length <= 70; length++) {
+        std::vector<uint8_t> bytes(length);
+        for (std::size_t i = 0; i < length; i++) {
+            bytes[i] = static_cast<uint8_t>(i * 37 + length);
+        }
+
+        ASSERT_EQ(HexUtil::toHex(bytes), referenceHex(bytes));
+    }
+
+    std::vector<uint8_t> all(256);
+    for (std::size_t i = 0; i < all.size(); i++) {
+        all[i] = static_cast<uint8_t>(i);
+    }
+    ASSERT_EQ(HexUtil::toHex(all), referenceHex(all));
+}
+
+TEST(HexUtilTest, decodesWhatIsEncoded)
+{
+    std::vector<uint8_t> all(256);
+    for (std::size_t i = 0; i < all.size(); i++) {
+        all[i] = static_cast<uint8_t>(255 - i);
+    }
+
+    for (std::size_t length = 0; length <= all.size(); length += 7) {
+        const std::vector<uint8_t> bytes(all.begin(), all.begin() + length);
+        std::vector<uint8_t> decoded;
+
+        ASSERT_TRUE(HexUtil::fromHex(HexUtil::toHex(bytes), decoded));
+        ASSERT_EQ(decoded, bytes);
+    }
+}
+
+TEST(HexUtilTest, decodesLowerCase)
+{
+    std::vector<uint8_t> decoded;
+
+    ASSERT_TRUE(HexUtil::fromHex(
+        "a0000004040125090101abcdefABCDEF0123456789", decoded));
+    ASSERT_EQ(
+        HexUtil::toHex(decoded), "A0000004040125090101ABCDEFABCDEF0123456789");
+}
+
+TEST(HexUtilTest, rejectsInvalidInput)
+{
+    std::vector<uint8_t> decoded;
+    const std::string valid(64, 'A');
+
+    ASSERT_FALSE(HexUtil::fromHex("ABC", decoded));
+
+    /* Every position, so that both the vectorized and scalar paths are hit */
+    const std::string invalidChars = std::string("G/:@`g \xC1", 8);
+    for (std::size_t pos = 0; pos < valid.size(); pos++) {
+        for (const char c : invalidChars) {
+            std::string hex = valid;
+            hex[pos] = c;
+            ASSERT_FALSE(HexUtil::fromHex(hex, decoded)) << pos << " " << c;
+        }
+    }
+}
@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/selection/IsoCardSelectorDefinition.hpp"
+
+using keypop::reader::selection::Aid;
+using keypop::reader::selection::AnyDfName;
+using keypop::reader::selection::BytesPredicate;
+using keypop::reader::selection::DfName;
+using keypop::reader::selection::FileControlInformation;
+using keypop::reader::selection::FileOccurrence;
+using keypop::reader::selection::IsoCardSelector;
+using keypop::reader::selection::IsoCardSelectorDefinition;
+
+namespace {
+
+struct Iso14443Protocol {
+    static constexpr const char*
+    name()
+    {
+        return "ISO_14443_4";
+    }
+};
+
+/**
+ * IsoCardSelector recording the applied filters.
+ */
+class IsoCardSelectorStub final : public IsoCardSelector {
+public:
+    IsoCardSelector&
+    filterByCardProtocol(const std::string& logicalProtocolName) override
+    {
+        mProtocol = logicalProtocolName;
+        return *this;
+    }
+
+    IsoCardSelector&
+    filterByPowerOnData(const std::string&) override
+    {
+        return *this;
+    }
+
+    IsoCardSelector&
+    filterByPowerOnDataMask(
+        const std::vector<uint8_t>&, const std::vector<uint8_t>&) override
+    {
+        return *this;
+    }
+
+    IsoCardSelector&
+    filterByPowerOnDataLength(const std::size_t, const std::size_t) override
+    {
+        return *this;
+    }
+
+    IsoCardSelector&
+    filterByPowerOnData(const BytesPredicate&) override
+    {
+        return *this;
+    }
+
+    IsoCardSelector&
+    filterByDfName(const std::vector<uint8_t>&) override
+    {
+        ADD_FAILURE() << "DF name expected as an Aid";
+        return *this;
+    }
+
+    IsoCardSelector&
+    filterByDfName(const std::string&) override
+    {
+        ADD_FAILURE() << "DF name expected as an Aid";
+        return *this;
+    }
+
+    IsoCardSelector&
+    filterByDfName(const Aid& aid) override
+    {
+        mDfName = aid;
+        return *this;
+    }
+
+    IsoCardSelector&
+    filterBySelectApplicationResponse(const BytesPredicate&) override
+    {
+        return *this;
+    }
+
+    IsoCardSelector&
+    setFileOccurrence(FileOccurrence fileOccurrence) override
+    {
+        mFileOccurrence = fileOccurrence;
+        return *this;
+    }
+
+    IsoCardSelector&
+    setFileControlInformation(
+        FileControlInformation fileControlInformation) override
+    {
+        mFileControlInformation = fileControlInformation;
+        return *this;
+    }
+
+    std::string mProtocol;
+    Aid mDfName;
+    FileOccurrence mFileOccurrence = FileOccurrence::FIRST;
+    FileControlInformation mFileControlInformation
+        = FileControlInformation::FCI;
+};
+
+typedef DfName<0xA0, 0x00, 0x00, 0x04, 0x04, 0x01, 0x25, 0x09> CalypsoDfName;
+
+} /* namespace */
+
+static_assert(CalypsoDfName::LENGTH == 8, "Unexpected DF name length");
+
+TEST(IsoCardSelectorDefinitionTest, appliesAllFilters)
+{
+    typedef IsoCardSelectorDefinition<
+        CalypsoDfName,
+        FileOccurrence::NEXT,
+        FileControlInformation::FCP,
+        Iso14443Protocol>
+        Definition;
+
+    IsoCardSelectorStub selector;
+    Definition::applyTo(selector);
+
+    ASSERT_EQ(selector.mDfName, Aid(std::string("A000000404012509")));
+    ASSERT_EQ(selector.mFileOccurrence, FileOccurrence::NEXT);
+    ASSERT_EQ(selector.mFileControlInformation, FileControlInformation::FCP);
+    ASSERT_EQ(selector.mProtocol, "ISO_14443_4");
+}
+
+TEST(IsoCardSelectorDefinitionTest, appliesDefaults)
+{
+    IsoCardSelectorStub selector;
+    selector.mFileOccurrence = FileOccurrence::LAST;
+    IsoCardSelectorDefinition<AnyDfName>::applyTo(selector);
+
+    ASSERT_TRUE(selector.mDfName.empty());
+    ASSERT_EQ(selector.mFileOccurrence, FileOccurrence::FIRST);
+    ASSERT_EQ(selector.mFileControlInformation, FileControlInformation::FCI);
+    ASSERT_TRUE(selector.mProtocol.empty());
+}
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/cpp/PowerOnDataFilterSet.hpp"
+#include "keypop/reader/cpp/PowerOnDataMaskMatcher.hpp"
+
+using keypop::reader::cpp::PowerOnDataFilterSet;
+using keypop::reader::cpp::PowerOnDataMaskMatcher;
+
+static const std::vector<uint8_t> ATR = {0x3B, 0x88, 0x80, 0x01, 0x00, 0x00,
+                                         0x00, 0x00, 0x71, 0x81, 0x00, 0xF9};
+
+TEST(PowerOnDataFilterSetTest, emptySetYieldsNoCandidate)
+{
+    const PowerOnDataFilterSet filterSet;
+    std::vector<bool> candidates(3, true);
+
+    filterSet.match(ATR.data(), ATR.size(), candidates);
+
+    ASSERT_TRUE(candidates.empty());
+}
+
+TEST(PowerOnDataFilterSetTest, yieldsMatchingAndUnfilteredCases)
+{
+    const std::vector<uint8_t> prefixMask = {0xFF, 0xFF, 0xFF, 0xFF};
+
+    PowerOnDataFilterSet filterSet;
+    ASSERT_EQ(
+        filterSet.addCase(
+            PowerOnDataMaskMatcher({0x3B, 0x8F, 0x80, 0x01}, prefixMask)),
+        0);
+    ASSERT_EQ(
+        filterSet.addCase(
+            PowerOnDataMaskMatcher({0x3B, 0x88, 0x80, 0x01}, prefixMask)),
+        1);
+    ASSERT_EQ(filterSet.addCase(), 2);
+    ASSERT_EQ(
+        filterSet.addCase(
+            PowerOnDataMaskMatcher({0x3B, 0x00}, {0xFF, 0x00})),
+        3);
+    ASSERT_EQ(
+        filterSet.addCase(
+            PowerOnDataMaskMatcher({0x3B, 0x88, 0x80, 0x01}, prefixMask)),
+        4);
+    ASSERT_EQ(filterSet.getCaseCount(), 5);
+
+    std::vector<bool> candidates;
+    filterSet.match(ATR.data(), ATR.size(), candidates);
+
+    ASSERT_THAT(
+        candidates,
+        ::testing::ElementsAre(false, true, true, true, true));
+}
+
+TEST(PowerOnDataFilterSetTest, appliesLengthRangeOfEachCase)
+{
+    PowerOnDataMaskMatcher shortAtr;
+    shortAtr.setLengthRange(0, 8);
+    PowerOnDataMaskMatcher longAtr;
+    longAtr.setLengthRange(9, 33);
+
+    PowerOnDataFilterSet filterSet;
+    filterSet.addCase(shortAtr);
+    filterSet.addCase(longAtr);
+
+    std::vector<bool> candidates;
+    filterSet.match(ATR.data(), ATR.size(), candidates);
+
+    ASSERT_THAT(candidates, ::testing::ElementsAre(false, true));
+}
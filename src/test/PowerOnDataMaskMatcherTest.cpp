@@ -0,0 +1,93 @@
+/******************************************************************************
+ * Copyright (c) 2025 Calypso Networks Association https://calypsonet.org/    *
+ *                                                                            *
+ * This program and the accompanying materials are made available under the   *
+ * terms of the MIT License which is available at                             *
+ * https://opensource.org/licenses/MIT.                                       *
+ *                                                                            *
+ * SPDX-License-Identifier: MIT                                               *
+ ******************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "keypop/reader/cpp/PowerOnDataMaskMatcher.hpp"
+
+using keypop::reader::cpp::PowerOnDataMaskMatcher;
+
+static const std::vector<uint8_t> ATR = {0x3B, 0x88, 0x80, 0x01, 0x00, 0x00,
+                                         0x00, 0x00, 0x71, 0x81, 0x00, 0xF9};
+
+TEST(PowerOnDataMaskMatcherTest, defaultMatcherMatchesAnything)
+{
+    const PowerOnDataMaskMatcher matcher;
+
+    ASSERT_TRUE(matcher.matches(ATR));
+    ASSERT_TRUE(matcher.matches(nullptr, 0));
+}
+
+TEST(PowerOnDataMaskMatcherTest, matchesOnMaskedBitsOnly)
+{
+    const PowerOnDataMaskMatcher matcher(
+        {0x3B, 0x88, 0x80, 0x01}, {0xFF, 0xF0, 0xFF, 0x00});
+
+    ASSERT_TRUE(matcher.matches(ATR));
+
+    std::vector<uint8_t> other = ATR;
+    other[1] = 0x8F;
+    other[3] = 0x55;
+    ASSERT_TRUE(matcher.matches(other));
+
+    other[2] = 0x81;
+    ASSERT_FALSE(matcher.matches(other));
+}
+
+TEST(PowerOnDataMaskMatcherTest, matchesPatternBeyondFirstWord)
+{
+    std::vector<uint8_t> mask(ATR.size(), 0x00);
+    mask[11] = 0xFF;
+    const PowerOnDataMaskMatcher matcher(ATR, mask);
+
+    ASSERT_TRUE(matcher.matches(ATR));
+
+    std::vector<uint8_t> other = ATR;
+    other[11] = 0xF8;
+    ASSERT_FALSE(matcher.matches(other));
+}
+
+TEST(PowerOnDataMaskMatcherTest, rejectsDataShorterThanPattern)
+{
+    const PowerOnDataMaskMatcher matcher(ATR, std::vector<uint8_t>(12, 0xFF));
+
+    ASSERT_FALSE(matcher.matches(ATR.data(), 11));
+}
+
+TEST(PowerOnDataMaskMatcherTest, appliesLengthRange)
+{
+    PowerOnDataMaskMatcher matcher;
+    matcher.setLengthRange(10, 12);
+
+    ASSERT_TRUE(matcher.matches(ATR.data(), 10));
+    ASSERT_TRUE(matcher.matches(ATR.data(), 12));
+    ASSERT_FALSE(matcher.matches(ATR.data(), 9));
+    ASSERT_FALSE(matcher.matches(std::vector<uint8_t>(13, 0x00)));
+}
+
+TEST(PowerOnDataMaskMatcherTest, rejectsInvalidArguments)
+{
+    PowerOnDataMaskMatcher matcher;
+
+    ASSERT_THROW(matcher.setPattern({}, {}), std::invalid_argument);
+    ASSERT_THROW(
+        matcher.setPattern({0x3B, 0x88}, {0xFF}), std::invalid_argument);
+    ASSERT_THROW(
+        matcher.setPattern(
+            std::vector<uint8_t>(34, 0x00), std::vector<uint8_t>(34, 0xFF)),
+        std::invalid_argument);
+    ASSERT_THROW(matcher.setLengthRange(5, 4), std::invalid_argument);
+}